@@ -2,10 +2,18 @@
 #include "OSAL_Tasks.h"
 #include "ZComDef.h"
 #include "hal_drivers.h"
+#include "hal_i2c.h"
+#include "adc_sampler.h"
+#include "uart_manager.h"
 
 #include "APS.h"
 #include "ZDApp.h"
 #include "nwk.h"
+#if defined(RTR_NWK)
+#include "AssocList.h"
+#include "nwk_util.h"
+#include "rtg.h"
+#endif
 
 #if defined ( MT_TASK )
   #include "MT.h"
@@ -14,14 +22,46 @@
 
 #include "commissioning.h"
 #include "factory_reset.h"
+#include "history.h"
+#include "stats.h"
+#include "clock_sync.h"
+#include "time_client.h"
+#include "log_stream.h"
+#include "diagnostics.h"
+#include "co2.h"
 #include "Debug.h"
 
 #include "bdb_interface.h"
 #include "zcl_app.h"
 
+#if defined(RTR_NWK)
+// The router tables and the heap leave room for the stack, the MAC and the
+// rest of XDATA. Checked at build time, a negative array size fails it
+#ifndef APP_RAM_BUDGET
+#define APP_RAM_BUDGET 4608
+#endif
+// The broadcast table is private to the NWK library, bytes per entry
+#ifndef APP_BCAST_ENTRY_SIZE
+#define APP_BCAST_ENTRY_SIZE 10
+#endif
+typedef char osalApp_RamBudgetCheck[(INT_HEAP_LEN + NWK_MAX_DEVICE_LIST * sizeof(associated_devices_t) +
+                                     MAX_RTG_ENTRIES * sizeof(rtgEntry_t) +
+                                     MAX_NEIGHBOR_ENTRIES * sizeof(neighborEntry_t) +
+                                     MAX_BCAST * APP_BCAST_ENTRY_SIZE) <= APP_RAM_BUDGET ? 1 : -1];
+#endif
+
 const pTaskEventHandlerFn tasksArr[] = {macEventLoop,
                                         nwk_event_loop,
                                         Hal_ProcessEvent,
+#if HAL_I2C
+                                        HalI2CProcessEvent,
+#endif
+#if HAL_ADC
+                                        adcSampler_event_loop,
+#endif
+#if UART_MANAGER
+                                        uartManager_event_loop,
+#endif
 #if defined( MT_TASK )
                                         MT_ProcessEvent,
 #endif
@@ -31,7 +71,17 @@ const pTaskEventHandlerFn tasksArr[] = {macEventLoop,
                                         bdb_event_loop,
                                         zclApp_event_loop,
                                         zclCommissioning_event_loop,
-                                        zclFactoryResetter_loop};
+                                        zclFactoryResetter_loop,
+                                        zclHistory_event_loop,
+                                        zclStats_event_loop,
+                                        zclClock_event_loop,
+                                        zclTimeClient_event_loop,
+                                        zclLogStream_event_loop,
+                                        zclDiagnostics_event_loop,
+#ifdef CO2_SENSOR
+                                        zclCO2_event_loop,
+#endif
+};
 
 const uint8 tasksCnt = sizeof(tasksArr) / sizeof(tasksArr[0]);
 uint16 *tasksEvents;
@@ -45,6 +95,15 @@ void osalInitTasks(void) {
     macTaskInit(taskID++);
     nwk_init(taskID++);
     Hal_Init(taskID++);
+#if HAL_I2C
+    HalI2CTaskInit(taskID++);
+#endif
+#if HAL_ADC
+    adcSampler_Init(taskID++);
+#endif
+#if UART_MANAGER
+    uartManager_Init(taskID++);
+#endif
 #if defined( MT_TASK )
   MT_TaskInit( taskID++ );
 #endif
@@ -55,6 +114,15 @@ void osalInitTasks(void) {
     zclApp_Init(taskID++);
     zclCommissioning_Init(taskID++);
     zclFactoryResetter_Init(taskID++);
+    zclHistory_Init(taskID++);
+    zclStats_Init(taskID++);
+    zclClock_Init(taskID++);
+    zclTimeClient_Init(taskID++);
+    zclLogStream_Init(taskID++);
+    zclDiagnostics_Init(taskID++);
+#ifdef CO2_SENSOR
+    zclCO2_Init(taskID++);
+#endif
 }
 
 /*********************************************************************
@@ -0,0 +1,157 @@
+#include "clock_sync.h"
+#define LOG_MODULE LOG_MODULE_CLOCK
+#include "Debug.h"
+#include "OSAL.h"
+#include "OSAL_Clock.h"
+#include "zcl_app.h"
+
+int32 zclClock_Drift = 0;
+uint32 zclClock_SyncInterval = CLOCK_SYNC_INTERVAL_MIN;
+
+int32 zclClock_TimeZone = 0;
+uint32 zclClock_DstStart = CLOCK_TIME_INVALID;
+uint32 zclClock_DstEnd = CLOCK_TIME_INVALID;
+int32 zclClock_DstShift = 0;
+
+static uint8 zclClock_TaskID;
+
+// Correction not applied to the clock yet, 1/256 us
+static int32 zclClock_Accumulator = 0;
+static uint32 zclClock_LastTick = 0;
+static uint32 zclClock_LastSync = 0;
+static bool zclClock_Synced = FALSE;
+static bool zclClock_Known = FALSE;
+
+static void zclClock_Correct(void);
+static int32 zclClock_UtcOffset(uint32 utc);
+
+void zclClock_Init(uint8 task_id) {
+    zclClock_TaskID = task_id;
+    zclClock_LastTick = osal_GetSystemClock();
+    osal_start_reload_timer(zclClock_TaskID, CLOCK_TICK_EVT, CLOCK_TICK_INTERVAL);
+}
+
+uint16 zclClock_event_loop(uint8 task_id, uint16 events) {
+    if (events & CLOCK_TICK_EVT) {
+        zclClock_Correct();
+        return (events ^ CLOCK_TICK_EVT);
+    }
+    return 0;
+}
+
+// Adds the drift of the time passed since the last call, whole seconds go to the clock
+static void zclClock_Correct(void) {
+    uint32 now = osal_GetSystemClock();
+    uint32 seconds = (now - zclClock_LastTick) / 1000;
+
+    // keep the remainder for the next call
+    zclClock_LastTick += seconds * 1000;
+    zclClock_Accumulator += (int32)seconds * zclClock_Drift;
+
+    osalTimeUpdate();
+    while (zclClock_Accumulator >= CLOCK_DRIFT_ONE_SECOND) {
+        zclClock_Accumulator -= CLOCK_DRIFT_ONE_SECOND;
+        osal_setClock(osal_getClock() + 1);
+    }
+    while (zclClock_Accumulator <= -CLOCK_DRIFT_ONE_SECOND) {
+        zclClock_Accumulator += CLOCK_DRIFT_ONE_SECOND;
+        osal_setClock(osal_getClock() - 1);
+    }
+}
+
+/*********************************************************************
+ * The offset left after the correction is the error of the drift
+ * estimate over the time since the previous sync. Half of it is added
+ * to the estimate, which smooths the 1 s resolution of the Time cluster.
+ */
+uint32 zclClock_Sync(uint32 remote) {
+    uint32 now = osal_GetSystemClock();
+    uint32 elapsed = (now - zclClock_LastSync) / 1000;
+    int32 offset;
+
+    zclClock_Correct();
+    offset = (int32)(remote - osal_getClock());
+
+    if (!zclClock_Synced || offset > CLOCK_STEP_THRESHOLD || offset < -CLOCK_STEP_THRESHOLD || elapsed < 60) {
+        zclClock_SyncInterval = CLOCK_SYNC_INTERVAL_MIN;
+    } else {
+        zclClock_Drift += offset * (CLOCK_DRIFT_ONE_SECOND / (int32)elapsed) / 2;
+        if (zclClock_Drift > CLOCK_DRIFT_MAX) {
+            zclClock_Drift = CLOCK_DRIFT_MAX;
+        } else if (zclClock_Drift < -CLOCK_DRIFT_MAX) {
+            zclClock_Drift = -CLOCK_DRIFT_MAX;
+        }
+
+        if (offset <= CLOCK_SYNC_TOLERANCE && offset >= -CLOCK_SYNC_TOLERANCE) {
+            if (zclClock_SyncInterval < CLOCK_SYNC_INTERVAL_MAX / 2) {
+                zclClock_SyncInterval *= 2;
+            } else {
+                zclClock_SyncInterval = CLOCK_SYNC_INTERVAL_MAX;
+            }
+        } else if (zclClock_SyncInterval > CLOCK_SYNC_INTERVAL_MIN * 2) {
+            zclClock_SyncInterval /= 2;
+        } else {
+            zclClock_SyncInterval = CLOCK_SYNC_INTERVAL_MIN;
+        }
+    }
+
+    LREP("Clock sync offset=%ld elapsed=%ld drift=%ld/256 ppm next=%ld\r\n", offset, elapsed, zclClock_Drift,
+         zclClock_SyncInterval);
+
+    osal_setClock(remote);
+    zclClock_Accumulator = 0;
+    zclClock_LastSync = now;
+    zclClock_Synced = TRUE;
+    zclClock_Known = TRUE;
+    return zclClock_SyncInterval;
+}
+
+void zclClock_Set(uint32 time) {
+    osal_setClock(time);
+    zclClock_Accumulator = 0;
+    zclClock_Known = TRUE;
+    // the next sync measures the error of the hand set time, not the drift
+    zclClock_Synced = FALSE;
+}
+
+void zclClock_SetLocal(uint32 local) {
+    zclClock_Set(local - zclClock_UtcOffset(local - zclClock_TimeZone));
+}
+
+void zclClock_SetZone(int32 timeZone, uint32 dstStart, uint32 dstEnd, int32 dstShift) {
+    zclClock_TimeZone = timeZone;
+    zclClock_DstStart = dstStart;
+    zclClock_DstEnd = dstEnd;
+    zclClock_DstShift = dstShift;
+}
+
+// Time zone plus DST shift if utc is inside the DST period
+static int32 zclClock_UtcOffset(uint32 utc) {
+    bool dst;
+
+    if (zclClock_DstStart == CLOCK_TIME_INVALID || zclClock_DstEnd == CLOCK_TIME_INVALID ||
+        zclClock_DstStart == zclClock_DstEnd) {
+        dst = FALSE;
+    } else if (zclClock_DstStart < zclClock_DstEnd) {
+        dst = (utc >= zclClock_DstStart) && (utc < zclClock_DstEnd);
+    } else {
+        // southern hemisphere, DST spans the new year
+        dst = (utc >= zclClock_DstStart) || (utc < zclClock_DstEnd);
+    }
+    return zclClock_TimeZone + (dst ? zclClock_DstShift : 0);
+}
+
+uint32 zclClock_LocalTime(void) {
+    uint32 utc = osal_getClock();
+    return utc + zclClock_UtcOffset(utc);
+}
+
+bool zclClock_Valid(void) { return zclClock_Known; }
+
+uint32 zclClock_SecondOfDay(void) {
+    return zclClock_LocalTime() % DAY;
+}
+
+uint8 zclClock_Weekday(void) {
+    return (uint8)((zclClock_LocalTime() / DAY + CLOCK_EPOCH_WEEKDAY) % 7);
+}
@@ -0,0 +1,62 @@
+#ifndef CLOCK_SYNC_H
+#define CLOCK_SYNC_H
+
+#define CLOCK_TICK_EVT 0x0001
+
+// The drift correction is applied to the OSAL clock once per tick
+#define CLOCK_TICK_INTERVAL ((uint32)60 * 1000) // 1 minute
+
+// Time sync interval bounds, the interval doubles while the clock stays
+// within CLOCK_SYNC_TOLERANCE and is halved when it does not
+#ifndef CLOCK_SYNC_INTERVAL_MIN
+#define CLOCK_SYNC_INTERVAL_MIN ((uint32)30 * 60 * 1000) // 30 minutes
+#endif
+
+#ifndef CLOCK_SYNC_INTERVAL_MAX
+#define CLOCK_SYNC_INTERVAL_MAX ((uint32)8 * 60 * 60 * 1000) // 8 hours
+#endif
+
+#ifndef CLOCK_SYNC_TOLERANCE
+#define CLOCK_SYNC_TOLERANCE 2 // seconds
+#endif
+
+// Offsets above this are clock steps (first sync, clock set by hand), not drift
+#define CLOCK_STEP_THRESHOLD 60 // seconds
+
+// Drift is kept in 1/256 ppm, 1 ppm is 1 us per second
+#define CLOCK_DRIFT_SHIFT 8
+#define CLOCK_DRIFT_ONE_SECOND ((int32)1000000 << CLOCK_DRIFT_SHIFT)
+#define CLOCK_DRIFT_MAX ((int32)500 << CLOCK_DRIFT_SHIFT) // +-500 ppm
+
+// ZCL time starts on 1 January 2000, which was a Saturday
+#define CLOCK_EPOCH_WEEKDAY 6 // 0 - Sunday
+
+#define CLOCK_TIME_INVALID 0xFFFFFFFF
+
+extern int32 zclClock_Drift;
+extern uint32 zclClock_SyncInterval;
+
+// Time zone and DST as reported by the time server, DstStart and DstEnd are UTC
+extern int32 zclClock_TimeZone;
+extern uint32 zclClock_DstStart;
+extern uint32 zclClock_DstEnd;
+extern int32 zclClock_DstShift;
+
+extern void zclClock_Init(uint8 task_id);
+extern uint16 zclClock_event_loop(uint8 task_id, uint16 events);
+
+// Sets the UTC clock from a time server, returns the interval to the next sync
+extern uint32 zclClock_Sync(uint32 remote);
+// Sets the UTC clock without using the offset for the drift estimate
+extern void zclClock_Set(uint32 time);
+extern void zclClock_SetLocal(uint32 local);
+extern void zclClock_SetZone(int32 timeZone, uint32 dstStart, uint32 dstEnd, int32 dstShift);
+// FALSE until the clock is set by a time server or by hand, it counts from 2000 after a reset
+extern bool zclClock_Valid(void);
+
+// Local time is derived from UTC on every call, so DST changes need no sync
+extern uint32 zclClock_LocalTime(void);
+extern uint32 zclClock_SecondOfDay(void);
+extern uint8 zclClock_Weekday(void);
+
+#endif
@@ -0,0 +1,67 @@
+#include "co2.h"
+#define LOG_MODULE LOG_MODULE_CO2
+#include "Debug.h"
+#include "OSAL.h"
+#include "bdb_interface.h"
+#include "mhz19.h"
+#include "senseair.h"
+#include "utils.h"
+#include "zcl_app.h"
+
+#ifdef CO2_SENSOR
+
+#if defined(HLK_PORT) && (CO2_UART_PORT == HLK_PORT)
+#error "CO2 sensor and the radar are on the same UART port"
+#endif
+
+uint32 zclCO2_MeasuredValue = 0;
+
+static uint8 zclCO2_TaskID;
+static bool zclCO2_Occupied = FALSE;
+
+static void zclCO2_Schedule(void);
+static void zclCO2_Measured(uint16 ppm);
+
+void zclCO2_Init(uint8 task_id) {
+    zclCO2_TaskID = task_id;
+    CO2_SENSOR.SetABC(CO2_ABC);
+    zclCO2_Schedule();
+    osal_set_event(zclCO2_TaskID, CO2_MEASURE_EVT);
+}
+
+uint16 zclCO2_event_loop(uint8 task_id, uint16 events) {
+    if (events & CO2_MEASURE_EVT) {
+        CO2_SENSOR.RequestMeasure(zclCO2_Measured);
+        return (events ^ CO2_MEASURE_EVT);
+    }
+    return 0;
+}
+
+// Only the answer to this request is reported, a failed one keeps the last value
+static void zclCO2_Measured(uint16 ppm) {
+    LREP("CO2 ppm=%d occupied=%d\r\n", ppm, zclCO2_Occupied);
+    if (ppm != AIR_QUALITY_INVALID_RESPONSE) {
+        zclCO2_MeasuredValue = ratioToFloat(ppm, 1000000);
+        bdb_RepChangedAttrValue(FOURTH_ENDPOINT, CO2, ATTRID_CO2_MEASURED_VALUE);
+    }
+}
+
+static void zclCO2_Schedule(void) {
+    osal_start_reload_timer(zclCO2_TaskID, CO2_MEASURE_EVT,
+                            zclCO2_Occupied ? CO2_INTERVAL_OCCUPIED : CO2_INTERVAL_EMPTY);
+}
+
+// Called on every radar frame as well, the interval changes with the state
+// only. A room that became occupied is sampled at once
+void zclCO2_Occupancy(bool occupied) {
+    if (occupied == zclCO2_Occupied) {
+        return;
+    }
+    zclCO2_Occupied = occupied;
+    zclCO2_Schedule();
+    if (occupied) {
+        osal_set_event(zclCO2_TaskID, CO2_MEASURE_EVT);
+    }
+}
+
+#endif
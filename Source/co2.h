@@ -0,0 +1,29 @@
+#ifndef CO2_H
+#define CO2_H
+
+#include "air_quality.h"
+
+#define CO2_MEASURE_EVT 0x0001
+
+// Sampling follows the occupancy: often while someone is in the room,
+// rarely when it is empty
+#ifndef CO2_INTERVAL_OCCUPIED
+#define CO2_INTERVAL_OCCUPIED ((uint32)30 * 1000) // 30 seconds
+#endif
+#ifndef CO2_INTERVAL_EMPTY
+#define CO2_INTERVAL_EMPTY ((uint32)10 * 60 * 1000) // 10 minutes
+#endif
+
+// Automatic baseline correction of the sensor
+#ifndef CO2_ABC
+#define CO2_ABC TRUE
+#endif
+
+// MeasuredValue of the CO2 cluster, IEEE 754 bits of ppm / 10^6
+extern uint32 zclCO2_MeasuredValue;
+
+extern void zclCO2_Init(uint8 task_id);
+extern uint16 zclCO2_event_loop(uint8 task_id, uint16 events);
+extern void zclCO2_Occupancy(bool occupied);
+
+#endif
@@ -0,0 +1,136 @@
+#include "diagnostics.h"
+#define LOG_MODULE LOG_MODULE_DIAGNOSTICS
+#include "Debug.h"
+#include "AssocList.h"
+#include "OSAL.h"
+#include "bdb_interface.h"
+#include "nwk_util.h"
+#include "zcl.h"
+#include "zcl_app.h"
+#include "zcl_diagnostic.h"
+#if defined(RTR_NWK)
+#include "nwk_globals.h"
+#endif
+
+// CC2530 MAC maps -97..10 dBm to LQI 0..255
+#define DIAGNOSTICS_RSSI_MIN -97
+#define DIAGNOSTICS_RSSI_RANGE 107
+
+zclDiagnostics_t zclDiagnostics = {.WorstNeighborLqi = 0xFF, .WorstNeighborAddr = INVALID_NODE_ADDR};
+
+static uint8 zclDiagnostics_TaskID;
+
+// One command timed at a time, the latency is to its data confirm
+static uint8 zclDiagnostics_PendingEndpoint = 0;
+static uint16 zclDiagnostics_PendingCluster;
+static uint32 zclDiagnostics_PendingTime;
+
+static void zclDiagnostics_Refresh(void);
+static void zclDiagnostics_Neighbor(uint16 addr, uint8 lqi);
+
+void zclDiagnostics_Init(uint8 task_id) {
+    uint8 lqiChange = 16;
+    uint16 countChange = 1;
+    uint16 latencyChange = 100;
+
+    zclDiagnostics_TaskID = task_id;
+
+    bdb_RepAddAttrCfgRecordDefaultToList(FIRST_ENDPOINT, DIAGNOSTIC, ATTRID_DIAGNOSTIC_LAST_MESSAGE_LQI,
+                                         DIAGNOSTICS_REPORT_MIN, DIAGNOSTICS_REPORT_MAX, &lqiChange);
+    bdb_RepAddAttrCfgRecordDefaultToList(FIRST_ENDPOINT, DIAGNOSTIC, ATTRID_DIAGNOSTIC_WORST_NEIGHBOR_LQI,
+                                         DIAGNOSTICS_REPORT_MIN, DIAGNOSTICS_REPORT_MAX, &lqiChange);
+    bdb_RepAddAttrCfgRecordDefaultToList(FIRST_ENDPOINT, DIAGNOSTIC, ATTRID_DIAGNOSTIC_APS_TX_UCAST_FAIL,
+                                         DIAGNOSTICS_REPORT_MIN, DIAGNOSTICS_REPORT_MAX, (uint8 *)&countChange);
+    bdb_RepAddAttrCfgRecordDefaultToList(FIRST_ENDPOINT, DIAGNOSTIC, ATTRID_DIAGNOSTIC_CONFIRM_LATENCY_MAX,
+                                         DIAGNOSTICS_REPORT_MIN, DIAGNOSTICS_REPORT_MAX, (uint8 *)&latencyChange);
+
+    osal_start_reload_timer(zclDiagnostics_TaskID, DIAGNOSTICS_REFRESH_EVT, DIAGNOSTICS_REFRESH_INTERVAL);
+}
+
+uint16 zclDiagnostics_event_loop(uint8 task_id, uint16 events) {
+    if (events & DIAGNOSTICS_REFRESH_EVT) {
+        zclDiagnostics_Refresh();
+        return (events ^ DIAGNOSTICS_REFRESH_EVT);
+    }
+    return 0;
+}
+
+static void zclDiagnostics_Neighbor(uint16 addr, uint8 lqi) {
+    if (lqi && lqi < zclDiagnostics.WorstNeighborLqi) {
+        zclDiagnostics.WorstNeighborLqi = lqi;
+        zclDiagnostics.WorstNeighborAddr = addr;
+    }
+}
+
+// The NWK layer keeps the LQI of the last frames from every link
+static void zclDiagnostics_Refresh(void) {
+    associated_devices_t *device;
+
+    zclDiagnostics.WorstNeighborLqi = 0xFF;
+    zclDiagnostics.WorstNeighborAddr = INVALID_NODE_ADDR;
+    for (uint8 i = 0; (device = AssocFindDevice(i)) != NULL; i++) {
+        zclDiagnostics_Neighbor(device->shortAddr, device->linkInfo.rxLqi);
+    }
+#if defined(RTR_NWK)
+    for (uint8 i = 0; i < MAX_NEIGHBOR_ENTRIES; i++) {
+        if (neighborTable[i].neighborAddress != INVALID_NODE_ADDR) {
+            zclDiagnostics_Neighbor(neighborTable[i].neighborAddress, neighborTable[i].linkInfo.rxLqi);
+        }
+    }
+#endif
+
+    device = AssocGetWithShort(_NIB.nwkCoordAddress);
+    zclDiagnostics.ParentLqi = device ? device->linkInfo.rxLqi : 0;
+    zclDiagnostics.ParentRssi =
+        (int8)(DIAGNOSTICS_RSSI_MIN + ((uint16)zclDiagnostics.ParentLqi * DIAGNOSTICS_RSSI_RANGE + 127) / 255);
+
+    LREP("Link parent lqi=%d rssi=%d worst lqi=%d addr=0x%X\r\n", zclDiagnostics.ParentLqi, zclDiagnostics.ParentRssi,
+         zclDiagnostics.WorstNeighborLqi, zclDiagnostics.WorstNeighborAddr);
+    bdb_RepChangedAttrValue(FIRST_ENDPOINT, DIAGNOSTIC, ATTRID_DIAGNOSTIC_LAST_MESSAGE_LQI);
+    bdb_RepChangedAttrValue(FIRST_ENDPOINT, DIAGNOSTIC, ATTRID_DIAGNOSTIC_WORST_NEIGHBOR_LQI);
+}
+
+void zclDiagnostics_CommandSent(uint8 endpoint, uint16 cluster) {
+    zclDiagnostics_PendingEndpoint = endpoint;
+    zclDiagnostics_PendingCluster = cluster;
+    zclDiagnostics_PendingTime = osal_GetSystemClock();
+}
+
+static void zclDiagnostics_Count(uint16 *counter) {
+    if (*counter < 0xFFFF) {
+        (*counter)++;
+    }
+}
+
+// Data confirms of the ZCL endpoints are passed on to the application task
+void zclDiagnostics_DataConfirm(afDataConfirm_t *confirm) {
+    uint8 status = confirm->hdr.status;
+
+    if (status == ZSuccess) {
+        zclDiagnostics_Count(&zclDiagnostics.ApsTxSuccess);
+    } else {
+        if (status == ZMacNoACK || status == ZMacChannelAccessFailure) {
+            zclDiagnostics_Count(&zclDiagnostics.MacTxFail);
+        }
+        if (status == ZApsNoAck) {
+            zclDiagnostics_Count(&zclDiagnostics.ApsTxFail);
+            bdb_RepChangedAttrValue(FIRST_ENDPOINT, DIAGNOSTIC, ATTRID_DIAGNOSTIC_APS_TX_UCAST_FAIL);
+        }
+        // a record about a lost log stream frame would be streamed and lost again
+        if (confirm->clusterID != MANU_CLUSTER) {
+            LOG_WARN("Data confirm status=0x%X ep=%d cluster=0x%X\r\n", status, confirm->endpoint, confirm->clusterID);
+        }
+    }
+
+    if (zclDiagnostics_PendingEndpoint == confirm->endpoint && zclDiagnostics_PendingCluster == confirm->clusterID) {
+        uint32 latency = osal_GetSystemClock() - zclDiagnostics_PendingTime;
+
+        zclDiagnostics_PendingEndpoint = 0;
+        zclDiagnostics.ConfirmLatency = latency > 0xFFFF ? 0xFFFF : (uint16)latency;
+        if (zclDiagnostics.ConfirmLatency > zclDiagnostics.ConfirmLatencyMax) {
+            zclDiagnostics.ConfirmLatencyMax = zclDiagnostics.ConfirmLatency;
+            bdb_RepChangedAttrValue(FIRST_ENDPOINT, DIAGNOSTIC, ATTRID_DIAGNOSTIC_CONFIRM_LATENCY_MAX);
+        }
+        LREP("Command confirmed in %d ms status=0x%X\r\n", zclDiagnostics.ConfirmLatency, status);
+    }
+}
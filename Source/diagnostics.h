@@ -0,0 +1,48 @@
+#ifndef DIAGNOSTICS_H
+#define DIAGNOSTICS_H
+
+#include "AF.h"
+
+#define DIAGNOSTICS_REFRESH_EVT 0x0001
+
+// Link quality is read from the NWK tables this often
+#ifndef DIAGNOSTICS_REFRESH_INTERVAL
+#define DIAGNOSTICS_REFRESH_INTERVAL ((uint32)5 * 60 * 1000) // 5 minutes
+#endif
+
+// Low rate reporting of the link attributes, seconds
+#ifndef DIAGNOSTICS_REPORT_MIN
+#define DIAGNOSTICS_REPORT_MIN 600
+#endif
+#ifndef DIAGNOSTICS_REPORT_MAX
+#define DIAGNOSTICS_REPORT_MAX 3600
+#endif
+
+// Manufacturer specific attributes of the Diagnostics cluster
+#define ATTRID_DIAGNOSTIC_WORST_NEIGHBOR_LQI   0xF010
+#define ATTRID_DIAGNOSTIC_WORST_NEIGHBOR_ADDR  0xF011
+#define ATTRID_DIAGNOSTIC_CONFIRM_LATENCY      0xF012 // ms
+#define ATTRID_DIAGNOSTIC_CONFIRM_LATENCY_MAX  0xF013 // ms
+
+// Kept in RAM only, counters saturate
+typedef struct {
+    uint8 ParentLqi;
+    int8 ParentRssi;        // dBm, derived from ParentLqi
+    uint8 WorstNeighborLqi;
+    uint16 WorstNeighborAddr;
+    uint16 MacTxFail;       // retries exhausted without a MAC ACK
+    uint16 ApsTxSuccess;
+    uint16 ApsTxFail;       // no APS ACK
+    uint16 ConfirmLatency;  // last command to its data confirm, ms
+    uint16 ConfirmLatencyMax;
+} zclDiagnostics_t;
+
+extern zclDiagnostics_t zclDiagnostics;
+
+extern void zclDiagnostics_Init(uint8 task_id);
+extern uint16 zclDiagnostics_event_loop(uint8 task_id, uint16 events);
+
+extern void zclDiagnostics_CommandSent(uint8 endpoint, uint16 cluster);
+extern void zclDiagnostics_DataConfirm(afDataConfirm_t *confirm);
+
+#endif
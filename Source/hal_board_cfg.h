@@ -103,6 +103,22 @@
   #define LED4_POLARITY     ACTIVE_LOW
 #endif
 
+/* LED1 PWM on Timer 1 channel 2. CMP: output set from 0 to T1CC2 for an active high LED,
+ * cleared for an active low one */
+#if defined(HAL_BOARD_TARGET)
+  #define HAL_LED_PWM_SEL       P0SEL
+  #define HAL_LED_PWM_BV        BV(4)
+  #define HAL_LED_PWM_CMP       0x20    /* clear on compare-up, set on 0 */
+  /* Timer 1 alt. 1 location, Timer 1 ch. 2-3 take priority over USART0 on P0 */
+  #define HAL_LED_PWM_PINS()    st( PERCFG &= ~0x40; P2DIR |= 0xC0; )
+#elif defined(HAL_BOARD_CHDTECH_DEV)
+  #define HAL_LED_PWM_SEL       P1SEL
+  #define HAL_LED_PWM_BV        BV(0)
+  #define HAL_LED_PWM_CMP       0x18    /* set on compare-up, clear on 0 */
+  /* Timer 1 alt. 2 location, Timer 1 has priority over Timer 4 on P1 by default */
+  #define HAL_LED_PWM_PINS()    st( PERCFG |= 0x40; )
+#endif
+
 
 
 /* ------------------------------------------------------------------------------------------------
@@ -381,6 +397,11 @@ st( \
 #define HAL_ADC TRUE
 #endif
 
+/* Set to TRUE to run the queued I2C transactions task, FALSE disable it */
+#ifndef HAL_I2C
+#define HAL_I2C FALSE
+#endif
+
 /* Set to TRUE enable DMA usage, FALSE disable it */
 #ifndef HAL_DMA
 #define HAL_DMA TRUE
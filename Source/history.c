@@ -0,0 +1,190 @@
+#include "history.h"
+#include "stats.h"
+#define LOG_MODULE LOG_MODULE_HISTORY
+#include "Debug.h"
+#include "OSAL.h"
+#include "OSAL_Clock.h"
+#include "zcl.h"
+#include "zcl_app.h"
+
+// status, seq, base time, count
+#define HISTORY_PAGE_HEADER_LEN 8
+#define HISTORY_RECORD_LEN 4
+
+static uint8 zclHistory_TaskID;
+
+// Block being filled and its NV slot
+static zclHistoryBlock_t zclHistory_Block;
+static uint8 zclHistory_Slot = HISTORY_BLOCKS - 1;
+static bool zclHistory_Dirty = FALSE;
+
+static uint32 zclHistory_LastTime = 0;
+static uint8 zclHistory_LastFlags = 0xFF;
+
+static void zclHistory_Flush(void);
+static void zclHistory_NextBlock(void);
+static bool zclHistory_ReadSeq(uint8 slot, uint16 *seq);
+
+static bool zclHistory_ReadSeq(uint8 slot, uint16 *seq) {
+    if (osal_nv_item_len(NW_APP_HISTORY_BASE + slot) != sizeof(zclHistoryBlock_t)) {
+        return FALSE;
+    }
+    return osal_nv_read(NW_APP_HISTORY_BASE + slot, 0, sizeof(uint16), seq) == ZSUCCESS;
+}
+
+void zclHistory_Init(uint8 task_id) {
+    zclHistory_TaskID = task_id;
+
+    // Newest block in NV, the slot after it becomes the head of the ring
+    bool found = FALSE;
+    uint16 newestSeq = 0;
+    for (uint8 slot = 0; slot < HISTORY_BLOCKS; slot++) {
+        uint16 seq;
+        if (zclHistory_ReadSeq(slot, &seq) && (!found || (int16)(seq - newestSeq) > 0)) {
+            newestSeq = seq;
+            zclHistory_Slot = slot;
+            found = TRUE;
+        }
+    }
+    zclHistory_Block.Seq = newestSeq;
+    zclHistory_NextBlock();
+    LREP("History slot=%d seq=%d\r\n", zclHistory_Slot, zclHistory_Block.Seq);
+}
+
+uint16 zclHistory_event_loop(uint8 task_id, uint16 events) {
+    if (events & HISTORY_FLUSH_EVT) {
+        LOG_TRACE("HISTORY_FLUSH_EVT\r\n");
+        zclHistory_Flush();
+        return (events ^ HISTORY_FLUSH_EVT);
+    }
+    return 0;
+}
+
+static void zclHistory_NextBlock(void) {
+    zclHistory_Slot = (zclHistory_Slot + 1) % HISTORY_BLOCKS;
+    zclHistory_Block.Seq++;
+    zclHistory_Block.BaseTime = 0;
+    zclHistory_Block.Count = 0;
+    osal_memset(zclHistory_Block.Records, 0, sizeof(zclHistory_Block.Records));
+    zclHistory_Dirty = FALSE;
+}
+
+static void zclHistory_Flush(void) {
+    uint16 id = NW_APP_HISTORY_BASE + zclHistory_Slot;
+    uint16 len;
+
+    osal_stop_timerEx(zclHistory_TaskID, HISTORY_FLUSH_EVT);
+    if (!zclHistory_Dirty) {
+        return;
+    }
+
+    len = osal_nv_item_len(id);
+    if (len != sizeof(zclHistoryBlock_t)) {
+        if (len) {
+            osal_nv_delete(id, len);
+        }
+        osal_nv_item_init(id, sizeof(zclHistoryBlock_t), NULL);
+    }
+    uint8 status = osal_nv_write(id, 0, sizeof(zclHistoryBlock_t), &zclHistory_Block);
+    zclStats_NvWrite();
+    LREP("History flush slot=%d seq=%d count=%d status=%d\r\n", zclHistory_Slot, zclHistory_Block.Seq,
+         zclHistory_Block.Count, status);
+    zclHistory_Dirty = FALSE;
+}
+
+void zclHistory_Append(bool occupied, uint8 targetType, uint16 distance) {
+    uint8 flags = (occupied ? HISTORY_FLAG_OCCUPIED : 0) | ((targetType << HISTORY_TARGET_SHIFT) & HISTORY_TARGET_MASK);
+    uint32 now = osal_getClock();
+    uint16 quantized = distance / HISTORY_DISTANCE_STEP;
+    zclHistoryRecord_t *record;
+
+    // Only state changes are events, distance alone is not logged
+    if (flags == zclHistory_LastFlags) {
+        return;
+    }
+    zclHistory_LastFlags = flags;
+
+    // Clock set back by a time sync or a gap too long for a 16-bit delta
+    if (zclHistory_Block.Count && ((now < zclHistory_LastTime) || (now - zclHistory_LastTime > 0xFFFF))) {
+        zclHistory_Flush();
+        zclHistory_NextBlock();
+    }
+
+    if (zclHistory_Block.Count == 0) {
+        zclHistory_Block.BaseTime = now;
+        zclHistory_LastTime = now;
+    }
+
+    record = &zclHistory_Block.Records[zclHistory_Block.Count++];
+    record->Delta = (uint16)(now - zclHistory_LastTime);
+    record->Flags = flags;
+    record->Distance = quantized > 0xFF ? 0xFF : (uint8)quantized;
+    zclHistory_LastTime = now;
+    zclHistory_Dirty = TRUE;
+
+    if (zclHistory_Block.Count == HISTORY_RECORDS_PER_BLOCK) {
+        zclHistory_Flush();
+        zclHistory_NextBlock();
+    } else if (osal_get_timeoutEx(zclHistory_TaskID, HISTORY_FLUSH_EVT) == 0) {
+        osal_start_timerEx(zclHistory_TaskID, HISTORY_FLUSH_EVT, HISTORY_FLUSH_INTERVAL);
+    }
+}
+
+/*********************************************************************
+ * Sends the oldest block with Seq >= seq. The block being filled is
+ * served from RAM, so the newest page includes records not flushed yet.
+ * Payload: status, seq, base time, count, count * (delta, flags, distance)
+ */
+void zclHistory_SendPage(uint8 endpoint, afAddrType_t *dstAddr, uint16 seq, uint8 transSeq) {
+    zclHistoryBlock_t *block = NULL;
+    bool found = FALSE;
+    uint16 foundSeq = 0;
+    uint8 foundSlot = 0;
+
+    for (uint8 slot = 0; slot < HISTORY_BLOCKS; slot++) {
+        uint16 slotSeq;
+        if (slot == zclHistory_Slot || !zclHistory_ReadSeq(slot, &slotSeq) || (int16)(slotSeq - seq) < 0) {
+            continue;
+        }
+        if (!found || (int16)(slotSeq - foundSeq) < 0) {
+            foundSeq = slotSeq;
+            foundSlot = slot;
+            found = TRUE;
+        }
+    }
+
+    if (found) {
+        block = (zclHistoryBlock_t *)osal_mem_alloc(sizeof(zclHistoryBlock_t));
+        if (block == NULL) {
+            return;
+        }
+        osal_nv_read(NW_APP_HISTORY_BASE + foundSlot, 0, sizeof(zclHistoryBlock_t), block);
+    } else if (zclHistory_Block.Count && (int16)(zclHistory_Block.Seq - seq) >= 0) {
+        block = &zclHistory_Block;
+    }
+
+    uint8 count = block ? block->Count : 0;
+    uint8 len = HISTORY_PAGE_HEADER_LEN + count * HISTORY_RECORD_LEN;
+    uint8 *buf = osal_mem_alloc(len);
+    if (buf != NULL) {
+        uint8 *p = buf;
+        *p++ = block ? ZCL_STATUS_SUCCESS : ZCL_STATUS_NOT_FOUND;
+        *p++ = LO_UINT16(block ? block->Seq : seq);
+        *p++ = HI_UINT16(block ? block->Seq : seq);
+        p = osal_buffer_uint32(p, block ? block->BaseTime : 0);
+        *p++ = count;
+        for (uint8 i = 0; i < count; i++) {
+            *p++ = LO_UINT16(block->Records[i].Delta);
+            *p++ = HI_UINT16(block->Records[i].Delta);
+            *p++ = block->Records[i].Flags;
+            *p++ = block->Records[i].Distance;
+        }
+        zcl_SendCommand(endpoint, dstAddr, MANU_CLUSTER, COMMAND_MANU_HISTORY_PAGE, TRUE, ZCL_FRAME_SERVER_CLIENT_DIR,
+                        TRUE, MANU_CLUSTER_CODE, transSeq, len, buf);
+        osal_mem_free(buf);
+    }
+
+    if (found) {
+        osal_mem_free(block);
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include "AF.h"
+
+#define HISTORY_FLUSH_EVT 0x0001
+
+// History is a ring of NV items, one block of records per item. A block
+// is written when it is full or on HISTORY_FLUSH_INTERVAL, OSAL NV spreads
+// the writes over its pages.
+#ifndef HISTORY_BLOCKS
+#define HISTORY_BLOCKS 8
+#endif
+
+#ifndef HISTORY_RECORDS_PER_BLOCK
+#define HISTORY_RECORDS_PER_BLOCK 16
+#endif
+
+#ifndef HISTORY_FLUSH_INTERVAL
+#define HISTORY_FLUSH_INTERVAL ((uint32)60 * 60 * 1000) // 1 hour
+#endif
+
+// cm per unit of the quantized distance
+#define HISTORY_DISTANCE_STEP 5
+
+#define NW_APP_HISTORY_BASE 0x0410
+
+#define HISTORY_FLAG_OCCUPIED 0x01
+#define HISTORY_TARGET_SHIFT  1
+#define HISTORY_TARGET_MASK   0x06
+
+typedef struct {
+    uint16 Delta;    // seconds since the previous record
+    uint8  Flags;    // bit 0 - occupancy, bits 1-2 - target type
+    uint8  Distance; // target distance / HISTORY_DISTANCE_STEP
+} zclHistoryRecord_t;
+
+typedef struct {
+    uint16 Seq;
+    uint32 BaseTime; // clock of the first record
+    uint8  Count;
+    zclHistoryRecord_t Records[HISTORY_RECORDS_PER_BLOCK];
+} zclHistoryBlock_t;
+
+extern void zclHistory_Init(uint8 task_id);
+extern uint16 zclHistory_event_loop(uint8 task_id, uint16 events);
+extern void zclHistory_Append(bool occupied, uint8 targetType, uint16 distance);
+extern void zclHistory_SendPage(uint8 endpoint, afAddrType_t *dstAddr, uint16 seq, uint8 transSeq);
+
+#endif
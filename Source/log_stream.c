@@ -0,0 +1,127 @@
+#include "log_stream.h"
+#include "Debug.h"
+#include "OSAL.h"
+#include "bdb_interface.h"
+#include "zcl.h"
+#include "zcl_app.h"
+
+// No LOG_* calls in this file, they would feed the stream itself
+
+uint8 zclLogStream_Level = 0;
+uint32 zclLogStream_Dropped = 0;
+
+static uint8 zclLogStream_TaskID;
+static afAddrType_t zclLogStream_Subscriber = {.addrMode = (afAddrMode_t)AddrNotPresent};
+
+static uint8 zclLogStream_Buffer[LOG_STREAM_BUFFER_SIZE];
+static uint8 zclLogStream_Len = 0;
+// dropped since the last drop record in the stream
+static uint16 zclLogStream_Lost = 0;
+
+#ifdef DEBUG_TOKENIZED
+static void zclLogStream_Sink(uint8 level, uint16 token, uint8 argc, uint8 *data, uint8 len);
+#endif
+static void zclLogStream_Flush(void);
+
+void zclLogStream_Init(uint8 task_id) {
+    zclLogStream_TaskID = task_id;
+#ifdef DEBUG_TOKENIZED
+    DebugSetSink(zclLogStream_Sink);
+#endif
+}
+
+uint16 zclLogStream_event_loop(uint8 task_id, uint16 events) {
+    if (events & LOG_STREAM_FLUSH_EVT) {
+        zclLogStream_Flush();
+        return (events ^ LOG_STREAM_FLUSH_EVT);
+    }
+    if (events & LOG_STREAM_LEVEL_EVT) {
+#ifdef DEBUG_TOKENIZED
+        DebugSetLevel(zclLogStream_Level);
+        // lets the decoder check its token table first
+        DebugLogBuild();
+#endif
+        return (events ^ LOG_STREAM_LEVEL_EVT);
+    }
+    return 0;
+}
+
+// Called before the level is written, the runtime log level follows it after
+void zclLogStream_Subscribe(afAddrType_t *dstAddr) {
+    zclLogStream_Subscriber = *dstAddr;
+    osal_set_event(zclLogStream_TaskID, LOG_STREAM_LEVEL_EVT);
+}
+
+#ifdef DEBUG_TOKENIZED
+static void zclLogStream_Put(uint16 token, uint8 argc, uint8 *data, uint8 len) {
+    uint8 *p = &zclLogStream_Buffer[zclLogStream_Len];
+
+    *p++ = DEBUG_SYNC;
+    *p++ = LO_UINT16(token);
+    *p++ = HI_UINT16(token);
+    *p++ = argc;
+    osal_memcpy(p, data, len);
+    zclLogStream_Len += 4 + len;
+}
+
+// Same record format as the UART, a lost record is reported before the next one
+static bool zclLogStream_Record(uint16 token, uint8 argc, uint8 *data, uint8 len) {
+    halIntState_t intState;
+    uint8 lost[4];
+    bool start;
+
+    HAL_ENTER_CRITICAL_SECTION(intState);
+    start = (zclLogStream_Len == 0);
+    if (zclLogStream_Len + 4 + len + (zclLogStream_Lost ? 8 : 0) > LOG_STREAM_BUFFER_SIZE) {
+        zclLogStream_Dropped++;
+        zclLogStream_Lost++;
+    } else {
+        if (zclLogStream_Lost) {
+            osal_buffer_uint32(lost, zclLogStream_Lost);
+            zclLogStream_Put(DEBUG_TOKEN_DROPPED, 1, lost, sizeof(lost));
+            zclLogStream_Lost = 0;
+        }
+        zclLogStream_Put(token, argc, data, len);
+    }
+    HAL_EXIT_CRITICAL_SECTION(intState);
+    return start;
+}
+
+static void zclLogStream_Sink(uint8 level, uint16 token, uint8 argc, uint8 *data, uint8 len) {
+    bool start = FALSE;
+
+    if (level > zclLogStream_Level || zclLogStream_Subscriber.addrMode == (afAddrMode_t)AddrNotPresent) {
+        return;
+    }
+
+    if (argc & DEBUG_ARGC_DUMP) {
+        uint8 chunk;
+
+        do {
+            chunk = MIN(len, LOG_STREAM_DUMP_CHUNK);
+            start |= zclLogStream_Record(token, DEBUG_ARGC_DUMP | chunk, data, chunk);
+            data += chunk;
+            len -= chunk;
+        } while (len);
+    } else {
+        start = zclLogStream_Record(token, argc, data, len);
+    }
+
+    if (start) {
+        osal_start_timerEx(zclLogStream_TaskID, LOG_STREAM_FLUSH_EVT, LOG_STREAM_INTERVAL);
+    }
+}
+#endif
+
+static void zclLogStream_Flush(void) {
+    halIntState_t intState;
+
+    if (zclLogStream_Len && zclLogStream_Level) {
+        zcl_SendCommand(FIRST_ENDPOINT, &zclLogStream_Subscriber, MANU_CLUSTER, COMMAND_MANU_LOG_RECORDS, TRUE,
+                        ZCL_FRAME_SERVER_CLIENT_DIR, TRUE, MANU_CLUSTER_CODE, bdb_getZCLFrameCounter(), zclLogStream_Len,
+                        zclLogStream_Buffer);
+    }
+    HAL_ENTER_CRITICAL_SECTION(intState);
+    zclLogStream_Len = 0;
+    HAL_EXIT_CRITICAL_SECTION(intState);
+}
@@ -0,0 +1,41 @@
+#ifndef LOG_STREAM_H
+#define LOG_STREAM_H
+
+#include "AF.h"
+
+#define LOG_STREAM_FLUSH_EVT 0x0001
+#define LOG_STREAM_LEVEL_EVT 0x0002
+
+// Tokenized log records (see Debug.h) over the air. The device that writes
+// the remote level becomes the subscriber, records up to that level are
+// sent to it in COMMAND_MANU_LOG_RECORDS frames. Calls compiled out by the
+// log thresholds are not sent whatever the remote level is, calls above the
+// remote level are not even built (Debug_Level).
+//
+// At most one frame per LOG_STREAM_INTERVAL, records that do not fit the
+// buffer meanwhile are dropped and counted. Dumps go as several records of
+// at most LOG_STREAM_DUMP_CHUNK bytes, so a radar frame dump fits.
+#ifndef LOG_STREAM_BUFFER_SIZE
+#define LOG_STREAM_BUFFER_SIZE 64
+#endif
+
+#ifndef LOG_STREAM_DUMP_CHUNK
+#define LOG_STREAM_DUMP_CHUNK 32
+#endif
+
+#if LOG_STREAM_DUMP_CHUNK + 4 + 8 > LOG_STREAM_BUFFER_SIZE
+#error "LOG_STREAM_DUMP_CHUNK record does not fit LOG_STREAM_BUFFER_SIZE"
+#endif
+
+#ifndef LOG_STREAM_INTERVAL
+#define LOG_STREAM_INTERVAL 1000 // 1 second
+#endif
+
+extern uint8 zclLogStream_Level; // LOG_LEVEL_*, 0 - off, not saved
+extern uint32 zclLogStream_Dropped;
+
+extern void zclLogStream_Init(uint8 task_id);
+extern uint16 zclLogStream_event_loop(uint8 task_id, uint16 events);
+extern void zclLogStream_Subscribe(afAddrType_t *dstAddr);
+
+#endif
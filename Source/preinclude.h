@@ -27,13 +27,63 @@
 
 
 #define HAL_LED TRUE
+#define HAL_LED_PWM TRUE
 #define HAL_ADC TRUE
+// AES without DMA, channels 1 and 2 are free for the ADC sampler
+#define HAL_AES_DMA FALSE
 #define HAL_LCD FALSE
 
 #define BLINK_LEDS TRUE
 
 #define LUMOISITY_PORT 0
 #define LUMOISITY_PIN 7
+// illuminance from the photoresistor on the lumosity pin, FALSE - from the radar frames
+#define LIGHT_ADC TRUE
+#define LIGHT_ADC_CHANNEL LUMOISITY_PIN
+
+// CO2 sensor on the 4th endpoint, MHZ19_dev or sense_air_dev on CO2_UART_PORT.
+// The port must not be the radar one
+// #define CO2_SENSOR MHZ19_dev
+#ifdef CO2_SENSOR
+    #define UART_MANAGER TRUE
+#endif
+
+// Network tables and heap by device type. The sensor is mains powered, the
+// router build (f8wRouter.cfg, RTR_NWK) routes for its neighbours and takes
+// children off the parent routers
+#if defined(RTR_NWK)
+    #ifndef NWK_MAX_DEVICE_LIST
+        #define NWK_MAX_DEVICE_LIST 16 // children
+    #endif
+    #ifndef MAX_NEIGHBOR_ENTRIES
+        #define MAX_NEIGHBOR_ENTRIES 16
+    #endif
+    #ifndef MAX_RTG_ENTRIES
+        #define MAX_RTG_ENTRIES 40
+    #endif
+    #ifndef MAX_RREQ_ENTRIES
+        #define MAX_RREQ_ENTRIES 8
+    #endif
+    #ifndef MAX_BCAST
+        #define MAX_BCAST 12
+    #endif
+    // frames held for sleeping children come from the heap
+    #define APP_HEAP_MIN (2048 + NWK_MAX_DEVICE_LIST * 64)
+    #ifndef INT_HEAP_LEN
+        #define INT_HEAP_LEN APP_HEAP_MIN
+    #endif
+#else
+    #ifndef MAX_RTG_ENTRIES
+        #define MAX_RTG_ENTRIES 40
+    #endif
+    #ifndef MAX_RREQ_ENTRIES
+        #define MAX_RREQ_ENTRIES 8
+    #endif
+    #ifndef MAX_BCAST
+        #define MAX_BCAST 9
+    #endif
+    #define APP_HEAP_MIN 2048
+#endif
 
 // one of this boards
 // #define HAL_BOARD_TARGET
@@ -51,7 +101,11 @@
     #define HLK_PORT  HAL_UART_PORT_0
     #define HAL_UART_DMA 1
     #define HAL_UART_ISR 2
-    #define INT_HEAP_LEN 2060//(2256 - 0xE)
+    #ifndef INT_HEAP_LEN
+        #define INT_HEAP_LEN 2060//(2256 - 0xE)
+    #endif
+    // log over the air to the device that writes ATTRID_LOG_LEVEL, see log_stream.h
+    // #define DO_DEBUG_OTA
 #elif defined(HAL_BOARD_CHDTECH_DEV)
     #define HAL_KEY_P0_INPUT_PINS BV(6)
     #define HAL_KEY_P0_INPUT_PINS_EDGE HAL_KEY_RISING_EDGE
@@ -69,7 +123,16 @@
 #ifdef DO_DEBUG_UART
     #define HAL_UART TRUE
     #define HAL_UART_DMA 1
-    #define INT_HEAP_LEN 2060
+    #ifndef INT_HEAP_LEN
+        #define INT_HEAP_LEN 2060
+    #endif
+#endif
+
+#if defined(INT_HEAP_LEN) && (INT_HEAP_LEN < APP_HEAP_MIN)
+#error "INT_HEAP_LEN is below APP_HEAP_MIN of this device type"
+#endif
+#if defined(RTR_NWK) && (MAX_NEIGHBOR_ENTRIES < 8 || MAX_BCAST < 9)
+#error "Router neighbor or broadcast table is too small to route"
 #endif
 
 #define HAL_UART TRUE
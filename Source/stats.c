@@ -0,0 +1,136 @@
+#include "stats.h"
+#include "clock_sync.h"
+#define LOG_MODULE LOG_MODULE_STATS
+#include "Debug.h"
+#include "OSAL.h"
+#include "OSAL_Clock.h"
+#include "zcl_app.h"
+
+zclStats_t zclStats;
+
+static uint8 zclStats_TaskID;
+static bool zclStats_Dirty = FALSE;
+static uint8 zclStats_Ticks = 0;
+
+static bool zclStats_Occupied = FALSE;
+static uint32 zclStats_SessionSeconds = 0;
+static uint32 zclStats_LastAccount = 0;
+
+static void zclStats_Accumulate(void);
+static void zclStats_CheckDay(void);
+static void zclStats_Checkpoint(void);
+
+void zclStats_Init(uint8 task_id) {
+    zclStats_TaskID = task_id;
+
+    osal_memset(&zclStats, 0, sizeof(zclStats_t));
+    zclStats.Day = STATS_DAY_UNKNOWN;
+    uint16 len = osal_nv_item_len(NW_APP_STATS);
+    if (len == sizeof(zclStats_t)) {
+        osal_nv_read(NW_APP_STATS, 0, sizeof(zclStats_t), &zclStats);
+    } else {
+        // first start or the counters layout has changed
+        if (len) {
+            osal_nv_delete(NW_APP_STATS, len);
+        }
+        osal_nv_item_init(NW_APP_STATS, sizeof(zclStats_t), &zclStats);
+    }
+    LREP("Stats restored len=%d sessions=%ld\r\n", len, zclStats.Sessions);
+
+    osal_start_reload_timer(zclStats_TaskID, STATS_TICK_EVT, STATS_TICK_INTERVAL);
+}
+
+uint16 zclStats_event_loop(uint8 task_id, uint16 events) {
+    if (events & STATS_TICK_EVT) {
+        zclStats_Accumulate();
+        zclStats_CheckDay();
+        if (++zclStats_Ticks >= STATS_CHECKPOINT_INTERVAL) {
+            zclStats_Ticks = 0;
+            zclStats_Checkpoint();
+        }
+        return (events ^ STATS_TICK_EVT);
+    }
+    return 0;
+}
+
+// Adds the time passed since the last call to the running session
+static void zclStats_Accumulate(void) {
+    uint32 now = osal_GetSystemClock();
+    if (zclStats_Occupied) {
+        uint32 seconds = (now - zclStats_LastAccount) / 1000;
+        // keep the remainder for the next call
+        zclStats_LastAccount += seconds * 1000;
+        zclStats_SessionSeconds += seconds;
+        zclStats.OccupiedToday += seconds;
+        if (zclStats_SessionSeconds > zclStats.LongestSession) {
+            zclStats.LongestSession = zclStats_SessionSeconds;
+        }
+        zclStats_Dirty = TRUE;
+    } else {
+        zclStats_LastAccount = now;
+    }
+}
+
+// The day number is kept with the counters, so a reboot or a time sync
+// across midnight rolls over once. A clock set back to an earlier day
+// moves the day only. Nothing is done until the clock has been set
+static void zclStats_CheckDay(void) {
+    if (!zclClock_Valid()) {
+        return;
+    }
+    uint16 day = (uint16)(zclClock_LocalTime() / DAY);
+    if (day == zclStats.Day) {
+        return;
+    }
+    if (zclStats.Day != STATS_DAY_UNKNOWN && day > zclStats.Day) {
+        LREP("Stats new day %d, occupied %ld s\r\n", day, zclStats.OccupiedToday);
+        // a day without a tick in between was not occupied
+        zclStats.OccupiedYesterday = (day == zclStats.Day + 1) ? zclStats.OccupiedToday : 0;
+        zclStats.OccupiedToday = 0;
+    }
+    zclStats.Day = day;
+    zclStats_Dirty = TRUE;
+}
+
+static void zclStats_Checkpoint(void) {
+    if (!zclStats_Dirty) {
+        return;
+    }
+    // the checkpoint itself is counted, but does not make the counters dirty again
+    zclStats.NvWrites++;
+    uint8 status = osal_nv_write(NW_APP_STATS, 0, sizeof(zclStats_t), &zclStats);
+    LREP("Stats checkpoint status=%d\r\n", status);
+    zclStats_Dirty = FALSE;
+}
+
+void zclStats_Occupancy(bool occupied) {
+    if (occupied == zclStats_Occupied) {
+        return;
+    }
+    zclStats_Accumulate();
+    zclStats_Occupied = occupied;
+    if (occupied) {
+        zclStats.Sessions++;
+        zclStats_SessionSeconds = 0;
+        zclStats_LastAccount = osal_GetSystemClock();
+    }
+    zclStats_Dirty = TRUE;
+}
+
+// Every engineering frame is counted, ~10 per second. The count alone does
+// not make the counters dirty, it is saved with the next checkpoint of the others
+void zclStats_RadarFrame(void) {
+    zclStats.RadarFrames++;
+}
+
+void zclStats_CommandSent(uint8 endpoint) {
+    if (endpoint >= FIRST_ENDPOINT && endpoint < FIRST_ENDPOINT + STATS_ENDPOINTS) {
+        zclStats.Commands[endpoint - FIRST_ENDPOINT]++;
+        zclStats_Dirty = TRUE;
+    }
+}
+
+void zclStats_NvWrite(void) {
+    zclStats.NvWrites++;
+    zclStats_Dirty = TRUE;
+}
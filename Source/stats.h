@@ -0,0 +1,40 @@
+#ifndef STATS_H
+#define STATS_H
+
+#define STATS_TICK_EVT 0x0001
+
+#define STATS_TICK_INTERVAL ((uint32)60 * 1000) // 1 minute
+
+// Counters are kept in RAM and written to NV not more often than this
+#ifndef STATS_CHECKPOINT_INTERVAL
+#define STATS_CHECKPOINT_INTERVAL 15 // minutes
+#endif
+
+#define NW_APP_STATS 0x0420
+
+#define STATS_ENDPOINTS 3
+
+#define STATS_DAY_UNKNOWN 0xFFFF
+
+typedef struct {
+    uint32 OccupiedToday;            // seconds
+    uint32 OccupiedYesterday;        // seconds
+    uint32 Sessions;
+    uint32 LongestSession;           // seconds
+    uint32 RadarFrames;
+    uint32 Commands[STATS_ENDPOINTS];
+    uint32 NvWrites;
+    uint16 Day; // local days since 2000 of OccupiedToday, STATS_DAY_UNKNOWN before the first time set
+} zclStats_t;
+
+extern zclStats_t zclStats;
+
+extern void zclStats_Init(uint8 task_id);
+extern uint16 zclStats_event_loop(uint8 task_id, uint16 events);
+
+extern void zclStats_Occupancy(bool occupied);
+extern void zclStats_RadarFrame(void);
+extern void zclStats_CommandSent(uint8 endpoint);
+extern void zclStats_NvWrite(void);
+
+#endif
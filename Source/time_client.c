@@ -0,0 +1,200 @@
+#include "time_client.h"
+#include "clock_sync.h"
+#define LOG_MODULE LOG_MODULE_TIME
+#include "Debug.h"
+#include "backoff.h"
+#include "OSAL.h"
+#include "OSAL_Clock.h"
+#include "ZDObject.h"
+#include "ZDProfile.h"
+#include "bdb_interface.h"
+#include "nwk_util.h"
+#include "zcl_app.h"
+
+uint8 zclTimeClient_Status = 0;
+uint32 zclTimeClient_Requests = 0;
+uint32 zclTimeClient_Responses = 0;
+
+static uint8 zclTimeClient_TaskID;
+
+// Requests in a row without an answer
+static uint8 zclTimeClient_Failures = 0;
+static bool zclTimeClient_Pending = FALSE;
+
+// TIME_BACKOFF_MIN doubling up to TIME_BACKOFF_MAX, the upper half randomized
+static CONST backoffConfig_t zclTimeClient_BackoffPolicy = {
+    .Min = TIME_BACKOFF_MIN, .Max = TIME_BACKOFF_MAX, .Growth = BACKOFF_GROWTH(2), .Jitter = BACKOFF_JITTER(0.5)};
+static backoff_t zclTimeClient_Backoff = {.Config = &zclTimeClient_BackoffPolicy, .Delay = TIME_BACKOFF_MIN};
+
+// Time servers found by match descriptor discovery
+static zclTimeServer_t zclTimeClient_Servers[TIME_SERVERS_MAX];
+static uint8 zclTimeClient_ServersCount = 0;
+static bool zclTimeClient_Fallback = FALSE;
+
+static void zclTimeClient_Request(void);
+static void zclTimeClient_Discover(void);
+static void zclTimeClient_ProcessZDOMsg(zdoIncomingMsg_t *inMsg);
+
+void zclTimeClient_Init(uint8 task_id) {
+    zclTimeClient_TaskID = task_id;
+    ZDO_RegisterForZDOMsg(zclTimeClient_TaskID, Match_Desc_rsp);
+    osal_start_timerEx(zclTimeClient_TaskID, TIME_REQ_EVT, TIME_REQ_INIT_DELAY);
+}
+
+uint16 zclTimeClient_event_loop(uint8 task_id, uint16 events) {
+    if (events & SYS_EVENT_MSG) {
+        osal_event_hdr_t *msg;
+        while ((msg = (osal_event_hdr_t *)osal_msg_receive(zclTimeClient_TaskID))) {
+            if (msg->event == ZDO_CB_MSG) {
+                zclTimeClient_ProcessZDOMsg((zdoIncomingMsg_t *)msg);
+            }
+            osal_msg_deallocate((uint8 *)msg);
+        }
+        return (events ^ SYS_EVENT_MSG);
+    }
+    if (events & TIME_REQ_EVT) {
+        LOG_TRACE("TIME_REQ_EVT\r\n");
+        zclTimeClient_Request();
+        return (events ^ TIME_REQ_EVT);
+    }
+    return 0;
+}
+
+static void zclTimeClient_Request(void) {
+    afAddrType_t dstAddr = {.addrMode = (afAddrMode_t)AddrNotPresent, .endPoint = 0, .addr.shortAddr = 0};
+    zclReadCmd_t *readCmd;
+
+    if (zclTimeClient_Pending && zclTimeClient_Failures < 0xFF) {
+        zclTimeClient_Failures++;
+    }
+
+    // The bound server does not answer, try the discovered ones in turn
+    zclTimeClient_Fallback = zclTimeClient_Failures >= TIME_FALLBACK_AFTER;
+    if (zclTimeClient_Fallback) {
+        if (zclTimeClient_ServersCount == 0 || zclTimeClient_Failures % TIME_FALLBACK_AFTER == 0) {
+            zclTimeClient_Discover();
+        }
+        if (zclTimeClient_ServersCount) {
+            zclTimeServer_t *server = &zclTimeClient_Servers[zclTimeClient_Failures % zclTimeClient_ServersCount];
+            dstAddr.addrMode = (afAddrMode_t)Addr16Bit;
+            dstAddr.addr.shortAddr = server->ShortAddr;
+            dstAddr.endPoint = server->EndPoint;
+        }
+    }
+
+    // Time, zone and DST in one request, local time is derived on the device.
+    // TimeStatus tells whether a discovered server has the time at all
+    readCmd = (zclReadCmd_t *)osal_mem_alloc(sizeof(zclReadCmd_t) + 6 * sizeof(uint16));
+    if (readCmd != NULL) {
+        readCmd->numAttr = 6;
+        readCmd->attrID[0] = ATTRID_TIME_TIME;
+        readCmd->attrID[1] = ATTRID_TIME_STATUS;
+        readCmd->attrID[2] = ATTRID_TIME_ZONE;
+        readCmd->attrID[3] = ATTRID_TIME_DST_START;
+        readCmd->attrID[4] = ATTRID_TIME_DST_END;
+        readCmd->attrID[5] = ATTRID_TIME_DST_SHIFT;
+        zcl_SendRead(FIRST_ENDPOINT, &dstAddr, GEN_TIME, readCmd, ZCL_FRAME_CLIENT_SERVER_DIR, TRUE,
+                     bdb_getZCLFrameCounter());
+        osal_mem_free(readCmd);
+        zclTimeClient_Requests++;
+        zclTimeClient_Pending = TRUE;
+    }
+
+    LREP("Time request failures=%d mode=%d addr=0x%X\r\n", zclTimeClient_Failures, dstAddr.addrMode,
+         dstAddr.addr.shortAddr);
+    osal_start_timerEx(zclTimeClient_TaskID, TIME_REQ_EVT, backoffNext(&zclTimeClient_Backoff));
+}
+
+static void zclTimeClient_Discover(void) {
+    zAddrType_t dstAddr;
+    cId_t cluster = GEN_TIME;
+
+    LREPMaster("Time server discovery\r\n");
+    zclTimeClient_ServersCount = 0;
+    dstAddr.addrMode = Addr16Bit;
+    dstAddr.addr.shortAddr = NWK_BROADCAST_SHORTADDR_DEVRXON;
+    ZDP_MatchDescReq(&dstAddr, NWK_BROADCAST_SHORTADDR_DEVRXON, ZCL_HA_PROFILE_ID, 1, &cluster, 0, NULL, FALSE);
+}
+
+static void zclTimeClient_ProcessZDOMsg(zdoIncomingMsg_t *inMsg) {
+    ZDO_ActiveEndpointRsp_t *rsp;
+
+    if (inMsg->clusterID != Match_Desc_rsp) {
+        return;
+    }
+    rsp = ZDO_ParseEPListRsp(inMsg);
+    if (rsp == NULL) {
+        return;
+    }
+    // this sensor is a Time server too, skip it
+    if (rsp->status == ZDP_SUCCESS && rsp->cnt && rsp->nwkAddr != NLME_GetShortAddr() &&
+        zclTimeClient_ServersCount < TIME_SERVERS_MAX) {
+        zclTimeClient_Servers[zclTimeClient_ServersCount].ShortAddr = rsp->nwkAddr;
+        zclTimeClient_Servers[zclTimeClient_ServersCount].EndPoint = rsp->epList[0];
+        zclTimeClient_ServersCount++;
+        LREP("Time server 0x%X ep=%d\r\n", rsp->nwkAddr, rsp->epList[0]);
+    }
+    osal_mem_free(rsp);
+}
+
+bool zclTimeClient_ProcessReadRsp(zclIncomingMsg_t *pInMsg) {
+    zclReadRspCmd_t *readRspCmd = (zclReadRspCmd_t *)pInMsg->attrCmd;
+    bool timeValid = FALSE;
+    uint8 status = 0;
+    uint32 time = 0;
+    int32 timeZone = zclClock_TimeZone;
+    uint32 dstStart = CLOCK_TIME_INVALID;
+    uint32 dstEnd = CLOCK_TIME_INVALID;
+    int32 dstShift = 0;
+
+    for (uint8 i = 0; i < readRspCmd->numAttr; i++) {
+        zclReadRspStatus_t *attr = &readRspCmd->attrList[i];
+        if (attr->status != ZCL_STATUS_SUCCESS) {
+            continue;
+        }
+
+        switch (attr->attrID) {
+        case ATTRID_TIME_TIME:
+            time = *((uint32 *)attr->data);
+            timeValid = (time != CLOCK_TIME_INVALID);
+            break;
+        case ATTRID_TIME_STATUS:
+            status = *attr->data;
+            break;
+        case ATTRID_TIME_ZONE:
+            timeZone = *((int32 *)attr->data);
+            break;
+        case ATTRID_TIME_DST_START:
+            dstStart = *((uint32 *)attr->data);
+            break;
+        case ATTRID_TIME_DST_END:
+            dstEnd = *((uint32 *)attr->data);
+            break;
+        case ATTRID_TIME_DST_SHIFT:
+            dstShift = *((int32 *)attr->data);
+            break;
+        default:
+            break;
+        }
+    }
+
+    // A discovered server may be another sensor that has no time yet
+    if (zclTimeClient_Fallback && !(status & (TIME_STATUS_MASTER | TIME_STATUS_SYNCHRONIZED))) {
+        timeValid = FALSE;
+    }
+    LREP("Time response valid=%d status=0x%X from 0x%X\r\n", timeValid, status, pInMsg->srcAddr.addr.shortAddr);
+    if (!timeValid) {
+        return FALSE;
+    }
+
+    zclTimeClient_Responses++;
+    zclTimeClient_Pending = FALSE;
+    zclTimeClient_Failures = 0;
+    backoffReset(&zclTimeClient_Backoff);
+    zclTimeClient_Status = TIME_STATUS_SYNCHRONIZED;
+
+    zclClock_SetZone(timeZone, dstStart, dstEnd, dstShift);
+    // next request after the interval chosen by the clock drift
+    osal_start_timerEx(zclTimeClient_TaskID, TIME_REQ_EVT, zclClock_Sync(time));
+    return TRUE;
+}
@@ -0,0 +1,47 @@
+#ifndef TIME_CLIENT_H
+#define TIME_CLIENT_H
+
+#include "zcl.h"
+
+#define TIME_REQ_EVT 0x0001
+
+// First request after start, then the interval chosen by clock_sync
+#define TIME_REQ_INIT_DELAY ((uint32)30 * 1000) // 30 seconds
+
+// Retry delay doubles with every unanswered request up to the cap,
+// half of it is random so sensors do not retry in step
+#ifndef TIME_BACKOFF_MIN
+#define TIME_BACKOFF_MIN ((uint32)30 * 1000) // 30 seconds
+#endif
+
+#ifndef TIME_BACKOFF_MAX
+#define TIME_BACKOFF_MAX ((uint32)60 * 60 * 1000) // 1 hour
+#endif
+
+// Unanswered requests to the bound server before other servers are tried
+#ifndef TIME_FALLBACK_AFTER
+#define TIME_FALLBACK_AFTER 3
+#endif
+
+#define TIME_SERVERS_MAX 4
+
+// TimeStatus bits, ZCL 3.12.2.2.2
+#define TIME_STATUS_MASTER       0x01
+#define TIME_STATUS_SYNCHRONIZED 0x02
+
+typedef struct {
+    uint16 ShortAddr;
+    uint8 EndPoint;
+} zclTimeServer_t;
+
+extern uint8 zclTimeClient_Status;
+extern uint32 zclTimeClient_Requests;
+extern uint32 zclTimeClient_Responses;
+
+extern void zclTimeClient_Init(uint8 task_id);
+extern uint16 zclTimeClient_event_loop(uint8 task_id, uint16 events);
+
+// Returns TRUE when the clock has been set from the response
+extern bool zclTimeClient_ProcessReadRsp(zclIncomingMsg_t *pInMsg);
+
+#endif
@@ -9,6 +9,8 @@
     #include "version.h"
 const uint8 zclApp_DateCode[] = { 16, '1', '4', '/', '0', '1', '/', '2', '0', '2', '5', ' ', '1', '8', ':', '5', '1' };
 const char zclApp_DateCodeNT[] = "14/01/2025 18:51";
+const uint32 zclApp_DateCodeNumber = 2501141851UL; // YYMMDDhhmm
+const uint32 Debug_TableId = 0xE2DAD739UL;
 
     #ifdef __cplusplus
     }
@@ -1,2 +1,3 @@
 extern const uint8 zclApp_DateCode[];
-extern const char zclApp_DateCodeNT[];
\ No newline at end of file
+extern const char zclApp_DateCodeNT[];
+extern const uint32 zclApp_DateCodeNumber;
\ No newline at end of file
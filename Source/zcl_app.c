@@ -6,7 +6,6 @@
 #include "ZComDef.h"
 #include "ZDApp.h"
 #include "ZDObject.h"
-#include "math.h"
 
 #include "nwk_util.h"
 #include "zcl.h"
@@ -19,12 +18,21 @@
 #include "bdb_interface.h"
 #include "gp_interface.h"
 
+#define LOG_MODULE LOG_MODULE_APP
 #include "Debug.h"
 
 #include "OnBoard.h"
 
+#include "backoff.h"
 #include "commissioning.h"
 #include "factory_reset.h"
+#include "history.h"
+#include "stats.h"
+#include "clock_sync.h"
+#include "time_client.h"
+#include "log_stream.h"
+#include "diagnostics.h"
+#include "co2.h"
 /* HAL */
 
 #include "hal_adc.h" 
@@ -32,6 +40,7 @@
 #include "hal_i2c.h"
 #include "hal_key.h"
 #include "hal_led.h"
+#include "light.h"
 
 #include "utils.h"
 #include "version.h"
@@ -68,11 +77,9 @@ byte zclApp_TaskID;
 
 // Структура для отправки отчета
 afAddrType_t zclApp_DstAddr;
-// Номер сообщения
-uint8 SeqNum = 0;
 
-
-uint32 zclApp_GenTime_old = 0;
+// Время записано вручную, часы выставляются при применении атрибутов
+static bool zclApp_LocalTimeWritten = FALSE;
 
 bool readHLK = FALSE;
 
@@ -89,6 +96,37 @@ afAddrType_t inderect_DstAddr = {.addrMode = (afAddrMode_t)AddrNotPresent, .endP
 
 static uint8 currentSensorsReadingPhase = 0;
 
+// Последний записанный во флеш образ настроек
+static application_config_t zclApp_ConfigNV;
+// Изменённые, но ещё не сохранённые поля настроек
+static uint16 zclApp_ConfigDirty = 0;
+
+// Доля LedBrightness по ступеням освещённости, 256 = 100%.
+// Ночью диод едва светится, днём горит в полную яркость
+static CONST uint16 zclApp_LedCurve[] = {8, 16, 32, 64, 112, 160, 208, 256};
+#define LED_CURVE_LENGTH (sizeof(zclApp_LedCurve) / sizeof(zclApp_LedCurve[0]))
+
+// Текущая ступень освещённости, 0xFF - ещё не измерена
+static uint8 zclApp_LightBucket = 0xFF;
+
+// Повторы включения инженерного режима, пока радар шлёт обычные кадры
+static CONST backoffConfig_t zclApp_EngModePolicy = {
+  .Min = APP_ENG_MODE_RETRY_MIN, .Max = APP_ENG_MODE_RETRY_MAX,
+  .Growth = BACKOFF_GROWTH(2), .Jitter = BACKOFF_JITTER(0.25)};
+static backoff_t zclApp_EngModeBackoff = {.Config = &zclApp_EngModePolicy, .Delay = APP_ENG_MODE_RETRY_MIN};
+
+// Пороги энергий ворот для уверенности присутствия
+#define CONFIDENCE_GATES 9
+static CONST uint8 zclApp_MovingGates[CONFIDENCE_GATES] = APP_CONFIDENCE_MOVING_GATES;
+static CONST uint8 zclApp_StillGates[CONFIDENCE_GATES] = APP_CONFIDENCE_STILL_GATES;
+
+// Сглаженная уверенность, 8 дробных бит
+static uint16 zclApp_ConfidenceEma = 0;
+// Последняя отправленная в отчёте уверенность
+static uint8 zclApp_ConfidenceReported = 0;
+// Порог уверенности, по которому сейчас определяется присутствие
+static uint8 zclApp_ConfidenceThresholdApplied = 0;
+
 /*********************************************************************
  * LOCAL FUNCTIONS
  */
@@ -99,6 +137,7 @@ static void zclApp_SetDayOutput(void);
 static void zclApp_ReadSensors(void);
 static void zclApp_Report(void);
 static void zclApp_SetNightOutput(void);
+static void zclApp_SendOnOff(uint8 endpoint, bool on);
 static bool zclApp_in_time(void);
 static void EnableEngMode(void);
 
@@ -108,25 +147,42 @@ static void SerialApp_CallBack(uint8 port, uint8 event);   // Receive data will
 static void zclApp_BasicResetCB(void);
 static void zclApp_RestoreAttributesFromNV(void);
 static void zclApp_SaveAttributesToNV(void);
+static uint8 zclApp_WriteConfigImage(void);
+static void zclApp_ApplyAttributes(void);
+static void zclApp_MarkConfigDirty(uint16 fields);
+static uint16 zclApp_ConfigFieldFlag(void *dataPtr);
 static void zclApp_HandleKeys(byte portAndAction, byte keyCode);
 static ZStatus_t zclApp_ReadWriteAuthCB(afAddrType_t *srcAddr, zclAttrRec_t *pAttr, uint8 oper);
 
-static void zclApp_reqLocalTime(void);
 static uint8 zclApp_ProcessInReadRspCmd(zclIncomingMsg_t *pInMsg);
+static ZStatus_t zclApp_ManuClusterHandler(zclIncoming_t *pInMsg);
 
 
 // Запуск чтения датчика
 static void zclApp_ReadHLK(void);
+static void zclApp_ReadIlluminance(void);
+#if LIGHT_ADC
+static void zclApp_IlluminanceCB(uint16 value);
+#endif
 // Изменение включения датчика
 static void updateSensor( bool );
 // Изменение включения диода
 static void updateLed( bool );
 // Изменение состояние реле
 static void updateOccupancy( bool );
+// Начало и конец присутствия по выходу OUT или по уверенности
+static void zclApp_SetPresence( bool );
+// Уверенность присутствия по инженерному кадру радара
+static uint8 zclApp_FrameConfidence( uint8 *frame );
+static void zclApp_UpdateConfidence( uint8 score );
+static void zclApp_ConfidencePresence( void );
+static void zclApp_ApplyConfidenceThreshold( void );
 // Отображение включения датчика
 static void applySensor( void );
 // Отображение включения диода
 static void applyLed( void );
+// Пересчёт ступени освещённости
+static void zclApp_UpdateLightBucket( void );
 // Отправка отчета о включении датчика
 void zclApp_ReportOnOff( void );
 // Отправка отчета о присутствии
@@ -151,10 +207,13 @@ static zclGeneral_AppCallbacks_t zclApp_CmdCallbacks1EP = {
 
 void zclApp_Init(byte task_id) {
   IO_IMODE_PORT_PIN(LUMOISITY_PORT, LUMOISITY_PIN, IO_TRI);         // tri state p0.7 (lumosity pin)
+  IO_DIR_PORT_PIN(LUMOISITY_PORT, LUMOISITY_PIN, IO_IN);
 
   HalLedSet(HAL_LED_1, HAL_LED_MODE_BLINK);
 
   zclApp_RestoreAttributesFromNV();
+  HalKeySetDebounce(HAL_KEY_PORT0, zclApp_Config.OutDebounce);
+  zclApp_ConfidenceThresholdApplied = zclApp_Config.ConfidenceThreshold;
 
   zclApp_TaskID = task_id;
 
@@ -172,16 +231,28 @@ void zclApp_Init(byte task_id) {
 
   zcl_registerAttrList(zclApp_ThirdEP.EndPoint, zclApp_AttrsThirdEPCount, zclApp_AttrsThirdEP);
 
+#ifdef CO2_SENSOR
+  bdb_RegisterSimpleDescriptor(&zclApp_FourthEP);
+
+  zcl_registerAttrList(zclApp_FourthEP.EndPoint, zclApp_AttrsFourthEPCount, zclApp_AttrsFourthEP);
+#endif
+
+  // отчёт об уверенности не чаще раза в секунду
+  uint8 confidenceChange = APP_CONFIDENCE_REPORT_STEP;
+  bdb_RepAddAttrCfgRecordDefaultToList(zclApp_FirstEP.EndPoint, OCCUPANCY, ATTRID_MS_OCCUPANCY_CONFIDENCE, 1, 3600,
+                                       &confidenceChange);
+
   zcl_registerReadWriteCB(zclApp_FirstEP.EndPoint, NULL, zclApp_ReadWriteAuthCB);
   zcl_registerReadWriteCB(zclApp_ThirdEP.EndPoint, NULL, zclApp_ReadWriteAuthCB);
 
+  zcl_registerPlugin(MANU_CLUSTER, MANU_CLUSTER, zclApp_ManuClusterHandler);
+
   zcl_registerForMsg(zclApp_TaskID);
   RegisterForKeys(zclApp_TaskID);
 
-  LREP("Build %s \r\n", zclApp_DateCodeNT);
+  LREP("Build %lu \r\n", zclApp_DateCodeNumber);
   
   osal_start_reload_timer(zclApp_TaskID, APP_REPORT_EVT, APP_REPORT_DELAY);
-  osal_start_reload_timer(zclApp_TaskID, APP_REQ_TIME_EVT, INIT_REQ_TIME_INTERVAL);
   
   LREP("START APP_REPORT_CLOCK_EVT\r\n");
   
@@ -204,44 +275,48 @@ int8 findSubstring(uint8 *array, uint8 arraySize, uint8 *sequence, uint8 sequenc
 
     if (match)
     {
-      LREP("match %d \r\n", i);
+      LOG_TRACE("match %d \r\n", i);
       return i;
     }
 
   }
 
-  LREPMaster("not match \r\n");
+  LOG_TRACE("not match \r\n");
   return -1;
 }
 
 void SerialApp_CallBack(uint8 port, uint8 event)   // Receive data will trigger
 {
-  if (readHLK)
-  {
-    uint8 response[RESPONSE_LENGHT] = {0x00};
-    HalUARTRead(HLK_PORT, (uint8 *)&response, sizeof(response) / sizeof(response[0]));
+  // Кадры читаются всегда: уверенность присутствия считается по каждому
+  uint8 response[RESPONSE_LENGHT] = {0x00};
+  HalUARTRead(HLK_PORT, (uint8 *)&response, sizeof(response) / sizeof(response[0]));
 
-      LREPMaster("CALLBACK UART \r\n");
-      for (int i = 0; i <= (RESPONSE_LENGHT - 1); i++) 
-      {
-        LREP("0x%X ", response[i]);
-      }
-      LREP("\r\n");
-    
-    int8 startBit = findSubstring(response, RESPONSE_LENGHT, startBits, 4, 0);
+    LOG_TRACE("CALLBACK UART \r\n");
+    LOG_DUMP(response, RESPONSE_LENGHT);
+  
+  int8 startBit = findSubstring(response, RESPONSE_LENGHT, startBits, 4, 0);
 
-    LREP("startBit = %d\r\n", startBit);
+  LOG_TRACE("startBit = %d\r\n", startBit);
+  
+  if (startBit >= 0) {
+    int8 endBit = findSubstring(response, RESPONSE_LENGHT, endBits, 4, startBit);
     
-    if (startBit >= 0) {
-      int8 endBit = findSubstring(response, RESPONSE_LENGHT, endBits, 4, startBit);
-      
-      if (endBit > startBit) {
-        if (response[4 + startBit] == 0x23) {
+    if (endBit > startBit) {
+      if (response[4 + startBit] == 0x23) {
 
+        zclStats_RadarFrame();
+        zclApp_UpdateConfidence(zclApp_FrameConfidence(&response[startBit]));
+        osal_start_timerEx(zclApp_TaskID, APP_CONFIDENCE_EVT, APP_CONFIDENCE_TIMEOUT);
+        backoffReset(&zclApp_EngModeBackoff);
+
+        if (readHLK) {
           zclApp_Distance = (uint16)(response[16 + startBit] * 0x100) + (uint16)response[15 + startBit];
           LREP("zclApp_Distance = %d\r\n", zclApp_Distance);
 
-          zclApp_IlluminanceSensor_MeasuredValue = (uint32)((response[37 + startBit]) * 155);
+#if !LIGHT_ADC
+          zclApp_IlluminanceSensor_MeasuredValue = luxToZclIlluminance(APP_RADAR_LUX(response[37 + startBit]));
+          zclApp_UpdateLightBucket();
+#endif
           
           switch (response[8 + startBit]) {
           case 0x00: 
@@ -258,16 +333,86 @@ void SerialApp_CallBack(uint8 port, uint8 event)   // Receive data will trigger
             break;
           }
 
+#if !LIGHT_ADC
           bdb_RepChangedAttrValue(zclApp_FirstEP.EndPoint, ILLUMINANCE, ATTRID_MS_ILLUMINANCE_MEASURED_VALUE);
+#endif
               
           updateOccupancy(zclApp_Occupied);
           
           readHLK = FALSE;
         }
-        else 
-          EnableEngMode(); 
+      }
+      else if (osal_get_timeoutEx(zclApp_TaskID, APP_ENABLE_ENG_EVT) == 0) {
+        // не слать команды на каждый обычный кадр, радар может быть занят
+        osal_start_timerEx(zclApp_TaskID, APP_ENABLE_ENG_EVT, backoffNext(&zclApp_EngModeBackoff));
+      }
+    }
+  }
+}
+
+// Уверенность кадра - наибольшее превышение энергии ворот над порогом,
+// отнесённое к запасу порога до 100. Учитываются ворота до заданных в радаре
+static uint8 zclApp_FrameConfidence(uint8 *frame) {
+  uint8 score = 0;
+  uint8 maxMoving = MIN(frame[17], CONFIDENCE_GATES - 1);
+  uint8 maxStill = MIN(frame[18], CONFIDENCE_GATES - 1);
+
+  for (uint8 gate = 0; gate < CONFIDENCE_GATES; gate++) {
+    uint8 energy, threshold, gateScore;
+
+    if (gate <= maxMoving) {
+      energy = MIN(frame[19 + gate], 100);
+      threshold = zclApp_MovingGates[gate];
+      if ((threshold < 100) && (energy > threshold)) {
+        gateScore = (uint8)((uint16)(energy - threshold) * 100 / (100 - threshold));
+        score = MAX(score, gateScore);
       }
     }
+    if (gate <= maxStill) {
+      energy = MIN(frame[28 + gate], 100);
+      threshold = zclApp_StillGates[gate];
+      if ((threshold < 100) && (energy > threshold)) {
+        gateScore = (uint8)((uint16)(energy - threshold) * 100 / (100 - threshold));
+        score = MAX(score, gateScore);
+      }
+    }
+  }
+  return score;
+}
+
+// Сглаживание уверенности, отчёт и присутствие по порогу уверенности
+static void zclApp_UpdateConfidence(uint8 score) {
+  uint16 sample = (uint16)score << 8;
+
+  if (sample >= zclApp_ConfidenceEma)
+    zclApp_ConfidenceEma += (sample - zclApp_ConfidenceEma) >> APP_CONFIDENCE_SHIFT;
+  else
+    zclApp_ConfidenceEma -= (zclApp_ConfidenceEma - sample + (1 << APP_CONFIDENCE_SHIFT) - 1) >> APP_CONFIDENCE_SHIFT;
+  zclApp_Confidence = (uint8)((zclApp_ConfidenceEma + 0x80) >> 8);
+
+  if ((zclApp_Confidence + APP_CONFIDENCE_REPORT_STEP <= zclApp_ConfidenceReported) ||
+      (zclApp_Confidence >= zclApp_ConfidenceReported + APP_CONFIDENCE_REPORT_STEP) ||
+      ((zclApp_Confidence == 0) != (zclApp_ConfidenceReported == 0))) {
+    zclApp_ConfidenceReported = zclApp_Confidence;
+    LOG_TRACE("Confidence %d\r\n", zclApp_Confidence);
+    bdb_RepChangedAttrValue(zclApp_FirstEP.EndPoint, OCCUPANCY, ATTRID_MS_OCCUPANCY_CONFIDENCE);
+  }
+
+  zclApp_ConfidencePresence();
+}
+
+static void zclApp_ConfidencePresence(void) {
+  uint8 threshold = zclApp_Config.ConfidenceThreshold;
+
+  // 0 - присутствие определяет выход OUT
+  if ((threshold == 0) || !zclApp_Config.SensorEnabled)
+    return;
+
+  if (!zclApp_Occupied && (zclApp_Confidence >= threshold)) {
+    zclApp_SetPresence(TRUE);
+  } else if (zclApp_Occupied &&
+             (zclApp_Confidence < ((threshold > APP_CONFIDENCE_HYSTERESIS) ? threshold - APP_CONFIDENCE_HYSTERESIS : 1))) {
+    zclApp_SetPresence(FALSE);
   }
 }
 
@@ -290,22 +435,45 @@ static void zclApp_InitHLKUart(void) {
 }
 
 static void zclApp_ReadHLK(void) {
-  LREPMaster("Read HLK \r\n");
+  LOG_TRACE("Read HLK \r\n");
 
   readHLK = TRUE;
 }
 
+// Освещённость с фоторезистора не зависит от радара и его инженерного режима
+static void zclApp_ReadIlluminance(void) {
+#if LIGHT_ADC
+  lightRead(zclApp_IlluminanceCB);
+#endif
+  zclApp_ReadHLK();
+}
+
+#if LIGHT_ADC
+// Измерение готово через пару мс, до zclApp_SetDayOutput на следующей фазе
+static void zclApp_IlluminanceCB(uint16 value) {
+  zclApp_IlluminanceSensor_MeasuredValue = value;
+  if (value != 0xFFFF) {
+    zclApp_UpdateLightBucket();
+  }
+  bdb_RepChangedAttrValue(zclApp_FirstEP.EndPoint, ILLUMINANCE, ATTRID_MS_ILLUMINANCE_MEASURED_VALUE);
+}
+#endif
+
 uint16 zclApp_event_loop(uint8 task_id, uint16 events) {
-    LREP("events 0x%x \r\n", events);
+    LOG_TRACE("events 0x%x \r\n", events);
     if (events & SYS_EVENT_MSG) {
         afIncomingMSGPacket_t *MSGpkt;
         while ((MSGpkt = (afIncomingMSGPacket_t *)osal_msg_receive(zclApp_TaskID))) {
-            LREP("MSGpkt->hdr.event 0x%X clusterId=0x%X\r\n", MSGpkt->hdr.event, MSGpkt->clusterId);
+            LOG_TRACE("MSGpkt->hdr.event 0x%X clusterId=0x%X\r\n", MSGpkt->hdr.event, MSGpkt->clusterId);
             switch (MSGpkt->hdr.event) {
             case KEY_CHANGE:
                 zclApp_HandleKeys(((keyChange_t *)MSGpkt)->state, ((keyChange_t *)MSGpkt)->keys);
                 break;
 
+            case AF_DATA_CONFIRM_CMD:
+                zclDiagnostics_DataConfirm((afDataConfirm_t *)MSGpkt);
+                break;
+
             case ZCL_INCOMING_MSG:
                 if (((zclIncomingMsg_t *)MSGpkt)->attrCmd) {
                   zclApp_ProcessInReadRspCmd( (zclIncomingMsg_t *)MSGpkt );
@@ -324,38 +492,51 @@ uint16 zclApp_event_loop(uint8 task_id, uint16 events) {
         return (events ^ SYS_EVENT_MSG);
     }
     if (events & APP_REPORT_EVT) {
-        LREPMaster("APP_REPORT_EVT\r\n");
+        LOG_TRACE("APP_REPORT_EVT\r\n");
         zclApp_Report();
         return (events ^ APP_REPORT_EVT);
     }
 
+    if (events & APP_APPLY_ATTRS_EVT) {
+        LOG_TRACE("APP_APPLY_ATTRS_EVT\r\n");
+        zclApp_ApplyAttributes();
+        return (events ^ APP_APPLY_ATTRS_EVT);
+    }
+
     if (events & APP_SAVE_ATTRS_EVT) {
-        LREPMaster("APP_SAVE_ATTRS_EVT\r\n");
+        LOG_TRACE("APP_SAVE_ATTRS_EVT\r\n");
         zclApp_SaveAttributesToNV();
         return (events ^ APP_SAVE_ATTRS_EVT);
     }
     if (events & APP_READ_SENSORS_EVT) {
-        LREPMaster("APP_READ_SENSORS_EVT\r\n");
+        LOG_TRACE("APP_READ_SENSORS_EVT\r\n");
         zclApp_ReadSensors();
         return (events ^ APP_READ_SENSORS_EVT);
     }
-    if (events & APP_REQ_TIME_EVT) {
-      LREPMaster("APP_REQ_TIME_EVT\r\n");
-      zclApp_reqLocalTime();      
-      return (events ^ APP_REQ_TIME_EVT);
-    }
     if (events & APP_GET_DISTANCE_EVT) {
-      LREPMaster("APP_GET_DISTANCE_EVT\r\n");
+      LOG_TRACE("APP_GET_DISTANCE_EVT\r\n");
       zclApp_ReadHLK();
       return (events ^ APP_GET_DISTANCE_EVT);
     }
+    if (events & APP_ENABLE_ENG_EVT) {
+      LOG_TRACE("APP_ENABLE_ENG_EVT\r\n");
+      EnableEngMode();
+      return (events ^ APP_ENABLE_ENG_EVT);
+    }
+    if (events & APP_CONFIDENCE_EVT) {
+      // кадры пропали: уверенность затухает до нуля, присутствие снимается по порогу
+      zclApp_UpdateConfidence(0);
+      if (zclApp_ConfidenceEma > 0)
+        osal_start_timerEx(zclApp_TaskID, APP_CONFIDENCE_EVT, APP_CONFIDENCE_DECAY_PERIOD);
+      return (events ^ APP_CONFIDENCE_EVT);
+    }
     return 0;
 }
 
 // обработка выхода с датчика
 static void zclApp_HandleKeys(byte portAndAction, byte keyCode) {
   LREP("zclApp_HandleKeys portAndAction=0x%X keyCode=0x%X\r\n", portAndAction, keyCode);
-  LREP("HAL_KEY_PORT0 = 0x%X\r\n", HAL_KEY_PORT0);
+  LOG_TRACE("HAL_KEY_PORT0 = 0x%X\r\n", HAL_KEY_PORT0);
 
 #if APP_COMMISSIONING_BY_LONG_PRESS
     if (bdbAttributes.bdbNodeIsOnANetwork == 1) {
@@ -367,51 +548,64 @@ static void zclApp_HandleKeys(byte portAndAction, byte keyCode) {
     zclCommissioning_HandleKeys(portAndAction, keyCode);
 
     if (portAndAction & HAL_KEY_PORT0) {
-
-      if (portAndAction & HAL_KEY_PRESS) {
-        LREPMaster("OCCUPIED\r\n");
-        updateOccupancy(TRUE);
-        zclApp_ReadHLK();
-        osal_start_timerEx(zclApp_TaskID, APP_REPORT_EVT, 200);
-        if (zclApp_Config.MeasurementPeriod > 0)
-          osal_start_reload_timer(zclApp_TaskID, APP_GET_DISTANCE_EVT, zclApp_Config.MeasurementPeriod * 1000);
-      }
-      if (portAndAction & HAL_KEY_RELEASE) {
-        updateOccupancy(FALSE);
-        osal_start_timerEx(zclApp_TaskID, APP_REPORT_EVT, 200);
-        osal_stop_timerEx(zclApp_TaskID, APP_GET_DISTANCE_EVT);
-        osal_clear_event(zclApp_TaskID, APP_GET_DISTANCE_EVT);
-      }
+      // Задержка от фронта OUT до обработки, окно антидребезга входит в неё
+      zclApp_DetectionLatency = (uint16)(osal_GetSystemClock() - HalKeyEdgeTime(HAL_KEY_PORT0));
+      LREP("OUT edge latency=%d ms glitches=%ld\r\n", zclApp_DetectionLatency, Hal_KeyGlitches[0]);
+
+      // при пороге уверенности присутствие определяют энергии ворот
+      if (zclApp_Config.ConfidenceThreshold > 0)
+        return;
+
+      if (portAndAction & HAL_KEY_PRESS)
+        zclApp_SetPresence(TRUE);
+      if (portAndAction & HAL_KEY_RELEASE)
+        zclApp_SetPresence(FALSE);
     }
 }
 
+static void zclApp_SetPresence(bool value) {
+  if (value) {
+    LREPMaster("OCCUPIED\r\n");
+    updateOccupancy(TRUE);
+    zclApp_ReadHLK();
+    osal_start_timerEx(zclApp_TaskID, APP_REPORT_EVT, 200);
+    if (zclApp_Config.MeasurementPeriod > 0)
+      osal_start_reload_timer(zclApp_TaskID, APP_GET_DISTANCE_EVT, zclApp_Config.MeasurementPeriod * 1000);
+  } else {
+    updateOccupancy(FALSE);
+    osal_start_timerEx(zclApp_TaskID, APP_REPORT_EVT, 200);
+    osal_stop_timerEx(zclApp_TaskID, APP_GET_DISTANCE_EVT);
+    osal_clear_event(zclApp_TaskID, APP_GET_DISTANCE_EVT);
+  }
+}
+
 static void zclApp_Report(void) {
   osal_start_reload_timer(zclApp_TaskID, APP_READ_SENSORS_EVT, 10); 
 }
 
 
 static void zclApp_ReadSensors(void) {
-  LREP("currentSensorsReadingPhase %d\r\n", currentSensorsReadingPhase);
+  LOG_TRACE("currentSensorsReadingPhase %d\r\n", currentSensorsReadingPhase);
 
   switch (currentSensorsReadingPhase++) {
   case 0:
-    LREPMaster("zclApp_ReadIlluminance\r\n");
-    zclApp_ReadHLK();
+    LOG_TRACE("zclApp_ReadIlluminance\r\n");
+    zclApp_ReadIlluminance();
     break;
   case 1:
-    LREPMaster("zclApp_SetDayOutput\r\n");
+    LOG_TRACE("zclApp_SetDayOutput\r\n");
     zclApp_SetDayOutput();
     break;
   case 2:
-    LREPMaster("zclApp_SetNightOutput\r\n");
+    LOG_TRACE("zclApp_SetNightOutput\r\n");
     zclApp_SetNightOutput();
     break;
   case 3:
-    LREPMaster("zclApp_UpdateClock\r\n");
+    LOG_TRACE("zclApp_UpdateClock\r\n");
     zclApp_UpdateClock();      
     break;
   default:
-    LREPMaster("Reset\r\n");
+    LOG_TRACE("Reset\r\n");
     osal_stop_timerEx(zclApp_TaskID, APP_READ_SENSORS_EVT);
     osal_clear_event(zclApp_TaskID, APP_READ_SENSORS_EVT);
     currentSensorsReadingPhase = 0;
@@ -428,7 +622,7 @@ void updateSensor ( bool value )
     updateOccupancy(FALSE);
 
   // сохраняем состояние датчика
-  zclApp_SaveAttributesToNV();
+  zclApp_MarkConfigDirty(CONFIG_DIRTY_SENSOR_ENABLED);
 
   // Меняем  датчик
   applySensor();
@@ -454,14 +648,32 @@ void updateOccupancy ( bool value )
   }
   LREP("value=%d\r\n", zclApp_Occupied);
 
+  zclHistory_Append(zclApp_Occupied, zclApp_TargetType, zclApp_Distance);
+  zclStats_Occupancy(zclApp_Occupied);
+#ifdef CO2_SENSOR
+  zclCO2_Occupancy(zclApp_Occupied);
+#endif
+
   bdb_RepChangedAttrValue(zclApp_FirstEP.EndPoint, OCCUPANCY , ATTRID_MS_OCCUPANCY_SENSING_CONFIG_OCCUPANCY);
 
   if (zclApp_Occupied)
-    zclGeneral_SendOnOff_CmdOn(zclApp_FirstEP.EndPoint, &inderect_DstAddr, TRUE, bdb_getZCLFrameCounter());
+    zclApp_SendOnOff(zclApp_FirstEP.EndPoint, TRUE);
   else
-    zclGeneral_SendOnOff_CmdOff(zclApp_FirstEP.EndPoint, &inderect_DstAddr, TRUE, bdb_getZCLFrameCounter());
+    zclApp_SendOnOff(zclApp_FirstEP.EndPoint, FALSE);
 }
   
+// Отправка команды привязанным устройствам
+static void zclApp_SendOnOff(uint8 endpoint, bool on)
+{
+  if (on)
+    zclGeneral_SendOnOff_CmdOn(endpoint, &inderect_DstAddr, TRUE, bdb_getZCLFrameCounter());
+  else
+    zclGeneral_SendOnOff_CmdOff(endpoint, &inderect_DstAddr, TRUE, bdb_getZCLFrameCounter());
+
+  zclStats_CommandSent(endpoint);
+  zclDiagnostics_CommandSent(endpoint, GEN_ON_OFF);
+}
+
 // Применение состояние датчика
 void applySensor ( void )
 {
@@ -480,18 +692,39 @@ void applySensor ( void )
 // Применение состояние диода
 void applyLed ( void )
 {
-  // если выключено
-  if (zclApp_Led) {
-    // иначе включаем светодиод 1
-    HalLedSet ( HAL_LED_1, HAL_LED_MODE_ON );
-  } else {
-    // то гасим светодиод 1
-    HalLedSet ( HAL_LED_1, HAL_LED_MODE_OFF );
+  uint8 brightness = zclApp_Config.LedBrightness;
+
+  // яркость по кривой от освещённости, но не до полного выключения
+  if (zclApp_Config.LedAdaptive && (zclApp_LightBucket != 0xFF)) {
+    uint8 bucket = (zclApp_LightBucket < LED_CURVE_LENGTH) ? zclApp_LightBucket : LED_CURVE_LENGTH - 1;
+    brightness = (uint8)(((uint16)brightness * zclApp_LedCurve[bucket]) >> 8);
+    if ((brightness == 0) && (zclApp_Config.LedBrightness > 0))
+      brightness = 1;
   }
+
+  // диод 1 плавно включается с заданной яркостью или гаснет
+  HalLedSetBrightness(zclApp_Led ? brightness : 0, APP_LED_FADE_TIME);
 }
 
 
+// Яркость диода меняется только при переходе на другую ступень освещённости
+static void zclApp_UpdateLightBucket(void) {
+  uint32 value = zclApp_IlluminanceSensor_MeasuredValue;
+  uint32 low = (uint32)zclApp_LightBucket << APP_LIGHT_BUCKET_SHIFT;
+  uint32 high = low + ((uint32)1 << APP_LIGHT_BUCKET_SHIFT);
+
+  if ((zclApp_LightBucket != 0xFF) && (value + APP_LIGHT_HYSTERESIS >= low) &&
+      (value < high + APP_LIGHT_HYSTERESIS))
+    return;
+
+  zclApp_LightBucket = (uint8)(value >> APP_LIGHT_BUCKET_SHIFT);
+  LOG_TRACE("Light bucket %d\r\n", zclApp_LightBucket);
+  if (zclApp_Config.LedAdaptive)
+    applyLed();
+}
+
 static bool zclApp_in_time(void){
+  uint32 secondOfDay = zclClock_SecondOfDay();
 
   if (zclApp_Config.TimeLow == zclApp_Config.TimeHigh){
     return TRUE;
@@ -499,10 +732,10 @@ static bool zclApp_in_time(void){
   else {
 
     if (zclApp_Config.TimeLow <  zclApp_Config.TimeHigh) {
-      return ((osal_getClock() >= zclApp_Config.TimeLow) & (osal_getClock() <= zclApp_Config.TimeHigh));
+      return ((secondOfDay >= zclApp_Config.TimeLow) & (secondOfDay <= zclApp_Config.TimeHigh));
     } 
     else {
-      return ((osal_getClock() < zclApp_Config.TimeLow) ^ (osal_getClock() > zclApp_Config.TimeHigh));
+      return ((secondOfDay < zclApp_Config.TimeLow) ^ (secondOfDay > zclApp_Config.TimeHigh));
     }
   }
 }
@@ -510,12 +743,14 @@ static bool zclApp_in_time(void){
 static void zclApp_SetDayOutput(void) {
   bool in_time = zclApp_in_time();
   
-  bool in_illuminance = (zclApp_IlluminanceSensor_MeasuredValue <= zclApp_Config.Threshold);
+  // Оба значения в единицах ZCL 10000*log10(lux)+1, 0xFFFF - освещённость неизвестна
+  bool in_illuminance = (zclApp_IlluminanceSensor_MeasuredValue != 0xFFFF) &&
+                        (zclApp_IlluminanceSensor_MeasuredValue <= zclApp_Config.Threshold);
   
   
-  LREP("in_time=%d\r\n", in_time);
-  LREP("in_illuminance=%d\r\n", in_illuminance);
-  LREP("led_mode=%d\r\n", zclApp_Config.LedMode);
+  LOG_TRACE("in_time=%d\r\n", in_time);
+  LOG_TRACE("in_illuminance=%d\r\n", in_illuminance);
+  LOG_TRACE("led_mode=%d\r\n", zclApp_Config.LedMode);
 
   if (zclApp_Occupied) {
     zclApp_DayOutput = (zclApp_DayOutput | (in_illuminance & in_time));
@@ -526,11 +761,11 @@ static void zclApp_SetDayOutput(void) {
   bdb_RepChangedAttrValue(zclApp_SecondEP.EndPoint, GEN_ON_OFF, ATTRID_ON_OFF);
 
   if (zclApp_DayOutput)
-    zclGeneral_SendOnOff_CmdOn(zclApp_SecondEP.EndPoint, &inderect_DstAddr, TRUE, bdb_getZCLFrameCounter());
+    zclApp_SendOnOff(zclApp_SecondEP.EndPoint, TRUE);
   else{
     
     if (!zclApp_Occupied) 
-      zclGeneral_SendOnOff_CmdOff(zclApp_SecondEP.EndPoint, &inderect_DstAddr, TRUE, bdb_getZCLFrameCounter());
+      zclApp_SendOnOff(zclApp_SecondEP.EndPoint, FALSE);
   }
 }
 
@@ -561,12 +796,12 @@ static void zclApp_SetNightOutput(void) {
   bdb_RepChangedAttrValue(zclApp_ThirdEP.EndPoint, GEN_ON_OFF, ATTRID_ON_OFF);
 
   if (zclApp_NightOutput)
-    zclGeneral_SendOnOff_CmdOn(zclApp_ThirdEP.EndPoint, &inderect_DstAddr, TRUE, bdb_getZCLFrameCounter());
+    zclApp_SendOnOff(zclApp_ThirdEP.EndPoint, TRUE);
   else {
-    zclGeneral_SendOnOff_CmdOff(zclApp_ThirdEP.EndPoint, &inderect_DstAddr, TRUE, bdb_getZCLFrameCounter());
+    zclApp_SendOnOff(zclApp_ThirdEP.EndPoint, FALSE);
 
     if (!in_time & !zclApp_Occupied) 
-      zclGeneral_SendOnOff_CmdOff(zclApp_SecondEP.EndPoint, &inderect_DstAddr, TRUE, bdb_getZCLFrameCounter());
+      zclApp_SendOnOff(zclApp_SecondEP.EndPoint, FALSE);
   }
     
 }
@@ -594,21 +829,107 @@ static void zclApp_OnOffCB1EP(uint8 cmd)
 static void zclApp_BasicResetCB(void) {
   LREPMaster("BasicResetCB\r\n");
   zclApp_ResetAttributesToDefaultValues();
-  zclApp_SaveAttributesToNV();
+  zclApp_MarkConfigDirty(CONFIG_DIRTY_ALL);
+  zclApp_ApplyAttributes();
 }
 
 static ZStatus_t zclApp_ReadWriteAuthCB(afAddrType_t *srcAddr, zclAttrRec_t *pAttr, uint8 oper) {
-  LREPMaster("AUTH CB called\r\n");
-  osal_start_timerEx(zclApp_TaskID, APP_SAVE_ATTRS_EVT, 200);
+  LOG_TRACE("AUTH CB called\r\n");
+  // Колбэк вызывается до записи значения, поэтому применяем и сохраняем позже
+  if (oper == ZCL_OPER_WRITE) {
+    zclApp_MarkConfigDirty(zclApp_ConfigFieldFlag(pAttr->attr.dataPtr));
+    if (pAttr->attr.dataPtr == &zclApp_GenTime_LocalTime)
+      zclApp_LocalTimeWritten = TRUE;
+    if (pAttr->attr.dataPtr == &zclLogStream_Level)
+      zclLogStream_Subscribe(srcAddr);
+  }
+  osal_start_timerEx(zclApp_TaskID, APP_APPLY_ATTRS_EVT, 200);
   return ZSuccess;
 }
 
+// Флаг поля настроек по адресу данных атрибута, 0 - атрибут не сохраняется во флеш
+static uint16 zclApp_ConfigFieldFlag(void *dataPtr) {
+  if (dataPtr == &zclApp_Config.SensorEnabled)
+    return CONFIG_DIRTY_SENSOR_ENABLED;
+  if (dataPtr == &zclApp_Config.Threshold)
+    return CONFIG_DIRTY_THRESHOLD;
+  if (dataPtr == &zclApp_Config.TimeLow)
+    return CONFIG_DIRTY_TIME_LOW;
+  if (dataPtr == &zclApp_Config.TimeHigh)
+    return CONFIG_DIRTY_TIME_HIGH;
+  if (dataPtr == &zclApp_Config.LedMode)
+    return CONFIG_DIRTY_LED_MODE;
+  if (dataPtr == &zclApp_Config.MeasurementPeriod)
+    return CONFIG_DIRTY_MEASUREMENT_PERIOD;
+  if (dataPtr == &zclApp_Config.OutDebounce)
+    return CONFIG_DIRTY_OUT_DEBOUNCE;
+  if (dataPtr == &zclApp_Config.LedBrightness)
+    return CONFIG_DIRTY_LED_BRIGHTNESS;
+  if (dataPtr == &zclApp_Config.LedAdaptive)
+    return CONFIG_DIRTY_LED_ADAPTIVE;
+  if (dataPtr == &zclApp_Config.ConfidenceThreshold)
+    return CONFIG_DIRTY_CONFIDENCE_THRESHOLD;
+  return 0;
+}
+
+// Отмечаем поля изменёнными; запись во флеш откладывается на APP_SAVE_ATTRS_DELAY,
+// все изменения внутри окна попадают в одну запись
+static void zclApp_MarkConfigDirty(uint16 fields) {
+  if (!fields)
+    return;
+
+  zclApp_ConfigDirty |= fields;
+
+  if (osal_get_timeoutEx(zclApp_TaskID, APP_SAVE_ATTRS_EVT) == 0)
+    osal_start_timerEx(zclApp_TaskID, APP_SAVE_ATTRS_EVT, APP_SAVE_ATTRS_DELAY);
+}
+
 static void zclApp_SaveAttributesToNV(void) {
-  uint8 writeStatus = osal_nv_write(NW_APP_CONFIG, 0, sizeof(application_config_t), &zclApp_Config);
-  LREP("Saving attributes to NV write=%d\r\n", writeStatus);
-  LREP("Delta  = %ld\r\n", zclApp_GenTime_LocalTime - zclApp_GenTime_old);
-  LREP("Delta clock = %ld\r\n", zclApp_GenTime_LocalTime - osal_getClock());
+  LREP("Config dirty = 0x%X\r\n", zclApp_ConfigDirty);
+  if (!zclApp_ConfigDirty)
+    return;
+
+  zclApp_ConfigDirty = 0;
+
+  // Значения могли вернуться к сохранённым, тогда флеш не трогаем
+  if (osal_memcmp(&zclApp_Config, &zclApp_ConfigNV, sizeof(application_config_t))) {
+    LREPMaster("Config unchanged, NV write skipped\r\n");
+    return;
+  }
+
+  uint8 writeStatus = zclApp_WriteConfigImage();
+  LREP("Saving attributes to NV write=%d count=%ld\r\n", writeStatus, zclApp_NvWriteCount);
+}
+
+// Запись образа настроек с заголовком. Если размер элемента NV не совпадает
+// с текущим образом (старая прошивка), элемент пересоздаётся
+static uint8 zclApp_WriteConfigImage(void) {
+  app_nv_image_t image;
+  uint16 len = osal_nv_item_len(NW_APP_CONFIG);
+
+  if (len != sizeof(app_nv_image_t)) {
+    if (len)
+      osal_nv_delete(NW_APP_CONFIG, len);
+    osal_nv_item_init(NW_APP_CONFIG, sizeof(app_nv_image_t), NULL);
+  }
+
+  image.Header.Magic = APP_NV_MAGIC;
+  image.Header.Version = APP_CONFIG_VERSION;
+  image.Header.Length = sizeof(application_config_t);
+  image.Header.Crc = crc16Ccitt((uint8 *)&zclApp_Config, sizeof(application_config_t));
+  image.Header.WriteCount = zclApp_NvWriteCount + 1;
+  osal_memcpy(&image.Config, &zclApp_Config, sizeof(application_config_t));
+
+  uint8 status = osal_nv_write(NW_APP_CONFIG, 0, sizeof(app_nv_image_t), &image);
+  if (status == ZSUCCESS) {
+    zclStats_NvWrite();
+    zclApp_NvWriteCount = image.Header.WriteCount;
+    osal_memcpy(&zclApp_ConfigNV, &zclApp_Config, sizeof(application_config_t));
+  }
+  return status;
+}
 
+static void zclApp_ApplyAttributes(void) {
   bool in_time = zclApp_in_time();
 
   LREP("LedMode = %d\r\n", zclApp_Config.LedMode);
@@ -632,10 +953,13 @@ static void zclApp_SaveAttributesToNV(void) {
   updateLed(zclApp_Led);
 
   
-  if (zclApp_GenTime_LocalTime != zclApp_GenTime_old) {
+  HalKeySetDebounce(HAL_KEY_PORT0, zclApp_Config.OutDebounce);
+  zclApp_ApplyConfidenceThreshold();
+
+  if (zclApp_LocalTimeWritten) {
     LREPMaster("CHANGE\r\n");
-    zclApp_GenTime_old = zclApp_GenTime_LocalTime;    
-    osal_setClock(zclApp_GenTime_LocalTime + 2);    
+    zclApp_LocalTimeWritten = FALSE;
+    zclClock_SetLocal(zclApp_GenTime_LocalTime);
   }
 
   if ((zclApp_Config.MeasurementPeriod > 0) & zclApp_Occupied) 
@@ -647,18 +971,72 @@ static void zclApp_SaveAttributesToNV(void) {
   }
 }
 
+// Смена порога уверенности: присутствие сразу пересчитывается по новому
+// источнику, иначе оно ждёт фронта OUT или следующего кадра
+static void zclApp_ApplyConfidenceThreshold(void) {
+  if (zclApp_Config.ConfidenceThreshold == zclApp_ConfidenceThresholdApplied)
+    return;
+  zclApp_ConfidenceThresholdApplied = zclApp_Config.ConfidenceThreshold;
+
+  if (zclApp_Config.ConfidenceThreshold == 0) {
+    bool out = (HalKeyState(HAL_KEY_PORT0) != 0);
+    LREP("Presence from OUT=%d\r\n", out);
+    if (out != zclApp_Occupied)
+      zclApp_SetPresence(out);
+  } else {
+    zclApp_ConfidencePresence();
+  }
+}
+
+// Чтение настроек. Понимает образ без заголовка от первых прошивок и образы
+// прошлых версий: отсутствующие в них поля остаются по умолчанию, затем
+// применяются переходы из zclApp_ConfigSchema и образ перезаписывается
 static void zclApp_RestoreAttributesFromNV(void) {
-  uint8 status = osal_nv_item_init(NW_APP_CONFIG, sizeof(application_config_t), NULL);
-  LREP("Restoring attributes from NV  status=%d \r\n", status);
-  if (status == NV_ITEM_UNINIT) {
-    uint8 writeStatus = osal_nv_write(NW_APP_CONFIG, 0, sizeof(application_config_t), &zclApp_Config);
-    LREP("NV was empty, writing %d\r\n", writeStatus);
+  app_nv_header_t header;
+  application_config_t config;
+  uint16 len = osal_nv_item_len(NW_APP_CONFIG);
+  uint8 version = 0;
+
+  LREP("Restoring attributes from NV len=%d\r\n", len);
+
+  if (len == zclApp_ConfigSchema[0].Size) {
+    LREPMaster("Reading legacy config from NV\r\n");
+    osal_nv_read(NW_APP_CONFIG, 0, len, &zclApp_Config);
+    version = 1;
+  } else if (len > sizeof(app_nv_header_t)) {
+    osal_nv_read(NW_APP_CONFIG, 0, sizeof(app_nv_header_t), &header);
+    if ((header.Magic == APP_NV_MAGIC) && (header.Version >= 1) && (header.Version <= APP_CONFIG_VERSION) &&
+        (header.Length == zclApp_ConfigSchema[header.Version - 1].Size) &&
+        (len == sizeof(app_nv_header_t) + header.Length)) {
+      osal_memcpy(&config, &zclApp_Config, sizeof(application_config_t));
+      osal_nv_read(NW_APP_CONFIG, sizeof(app_nv_header_t), header.Length, &config);
+      if (crc16Ccitt((uint8 *)&config, header.Length) == header.Crc) {
+        LREP("Reading config v%d from NV\r\n", header.Version);
+        osal_memcpy(&zclApp_Config, &config, sizeof(application_config_t));
+        zclApp_NvWriteCount = header.WriteCount;
+        version = header.Version;
+      }
+    }
   }
-  if (status == ZSUCCESS) {
-    LREPMaster("Reading from NV\r\n");
-    osal_nv_read(NW_APP_CONFIG, 0, sizeof(application_config_t), &zclApp_Config);
+
+  if (version == APP_CONFIG_VERSION && len == sizeof(app_nv_image_t)) {
+    osal_memcpy(&zclApp_ConfigNV, &zclApp_Config, sizeof(application_config_t));
     applySensor();
+    return;
   }
+
+  if (version) {
+    for (uint8 v = version; v < APP_CONFIG_VERSION; v++) {
+      if (zclApp_ConfigSchema[v - 1].Upgrade != NULL)
+        zclApp_ConfigSchema[v - 1].Upgrade((uint8 *)&zclApp_Config);
+    }
+    applySensor();
+  } else {
+    LOG_WARN("NV config empty or corrupted, using defaults\r\n");
+  }
+
+  uint8 writeStatus = zclApp_WriteConfigImage();
+  LREP("NV config v%d migrated, writing %d\r\n", version, writeStatus);
 }
 
 
@@ -668,45 +1046,47 @@ static void zclApp_RestoreAttributesFromNV(void) {
 void zclApp_UpdateClock(void)
 {
   osalTimeUpdate();
-  zclApp_GenTime_LocalTime = osal_getClock();
-  
-  zclApp_GenTime_LocalTime %= DAY;
+  zclApp_GenTime_Time = osal_getClock();
+  zclApp_GenTime_LocalTime = zclClock_LocalTime();
  
-  LREP("CLOCK = %ld\r\n", osal_getClock());
+  LREP("CLOCK = %ld\r\n", zclApp_GenTime_Time);
   LREP("TIME = %ld\r\n", zclApp_GenTime_LocalTime);
+  LREP("WEEKDAY = %d\r\n", zclClock_Weekday());
   LREP("TIME_LOW = %ld\r\n", zclApp_Config.TimeLow);
   LREP("TIME_HIGH = %ld\r\n", zclApp_Config.TimeHigh);
 }
 
-static void zclApp_reqLocalTime(void) {
-  zclReadCmd_t readCmd;
-  readCmd.numAttr = 1;
-  readCmd.attrID[0] = ATTRID_TIME_LOCAL_TIME;  // Attribute ID of LocalTime in Cluster Time is 7 (see ZigBee Cluster Library spec)
-  zcl_SendRead(1, &inderect_DstAddr, GEN_TIME, &readCmd, ZCL_FRAME_CLIENT_SERVER_DIR, true, SeqNum++);
-  LREPMaster("TIME REQUEST SENT! \r\n");
-}
-
 static uint8 zclApp_ProcessInReadRspCmd(zclIncomingMsg_t *pInMsg)
 {
-  zclReadRspCmd_t * readRspCmd;
-  readRspCmd = (zclReadRspCmd_t *) pInMsg->attrCmd;
   switch(pInMsg->clusterId)
   {
   case GEN_TIME:
-    {
-      LREP("TIME = %ld\r\n", zclApp_GenTime_LocalTime);
-      zclApp_GenTime_LocalTime = * ((uint32 *) readRspCmd->attrList[0].data);
-      zclApp_GenTime_LocalTime %= DAY;
-      LREP("TIME = %ld\r\n", zclApp_GenTime_LocalTime);
-      osal_setClock(zclApp_GenTime_LocalTime);
-
-      osal_start_reload_timer(zclApp_TaskID, APP_REQ_TIME_EVT, REQ_TIME_INTERVAL);
-    }
+    if ((pInMsg->zclHdr.commandID == ZCL_CMD_READ_RSP) && zclTimeClient_ProcessReadRsp(pInMsg))
+      zclApp_UpdateClock();
   break;
   }
   return TRUE;
 }
 
+// Команды производителя
+static ZStatus_t zclApp_ManuClusterHandler(zclIncoming_t *pInMsg)
+{
+  if (pInMsg->hdr.fc.direction != ZCL_FRAME_CLIENT_SERVER_DIR)
+    return ZFailure;
+
+  switch (pInMsg->hdr.commandID) {
+  case COMMAND_MANU_GET_HISTORY:
+    if (pInMsg->pDataLen < 2)
+      return ZCL_STATUS_INVALID_VALUE;
+    zclHistory_SendPage(pInMsg->msg->endPoint, &pInMsg->msg->srcAddr,
+                        BUILD_UINT16(pInMsg->pData[0], pInMsg->pData[1]), pInMsg->hdr.transSeqNum);
+    return ZCL_STATUS_CMD_HAS_RSP;
+
+  default:
+    return ZFailure;
+  }
+}
+
 static void EnableEngMode(void)
 {
   HalUARTWrite(HLK_PORT, startConfig, sizeof(startConfig) / sizeof(startConfig[0])); 
@@ -714,6 +1094,4 @@ static void EnableEngMode(void)
   HalUARTWrite(HLK_PORT, engMode, sizeof(engMode) / sizeof(engMode[0])); 
   user_delay_ms(200);
   HalUARTWrite(HLK_PORT, stopConfig, sizeof(stopConfig) / sizeof(stopConfig[0])); 
-//  osal_stop_timerEx(zclApp_TaskID, APP_ENABLE_ENG_EVT);
-//  osal_clear_event(zclApp_TaskID, APP_ENABLE_ENG_EVT);
 }
\ No newline at end of file
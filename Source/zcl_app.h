@@ -23,12 +23,85 @@ extern "C" {
 #define APP_REPORT_EVT          0x0001
 #define APP_READ_SENSORS_EVT    0x0002
 #define APP_SAVE_ATTRS_EVT      0x0004
-#define APP_REQ_TIME_EVT        0x0008  
+//#define APP_REQ_TIME_EVT        0x0008
 #define APP_GET_DISTANCE_EVT    0x0010
-//#define APP_ENABLE_ENG_EVT      0x0020
-  
-#define INIT_REQ_TIME_INTERVAL  ((uint32) 30000)
-#define REQ_TIME_INTERVAL       ((uint32) 1800000)
+#define APP_ENABLE_ENG_EVT      0x0020
+#define APP_APPLY_ATTRS_EVT     0x0040
+#define APP_CONFIDENCE_EVT      0x0080
+
+// Окно объединения записей настроек во флеш
+#ifndef APP_SAVE_ATTRS_DELAY
+#define APP_SAVE_ATTRS_DELAY    ((uint32) 5000)
+#endif
+
+// Время плавного включения и выключения диода, мс
+#ifndef APP_LED_FADE_TIME
+#define APP_LED_FADE_TIME       500
+#endif
+
+// Повтор включения инженерного режима радара: задержка удваивается
+// от APP_ENG_MODE_RETRY_MIN до APP_ENG_MODE_RETRY_MAX, мс
+#ifndef APP_ENG_MODE_RETRY_MIN
+#define APP_ENG_MODE_RETRY_MIN  ((uint32) 1000)
+#endif
+#ifndef APP_ENG_MODE_RETRY_MAX
+#define APP_ENG_MODE_RETRY_MAX  ((uint32) 60000)
+#endif
+
+// Освещённость делится на ступени по 2^APP_LIGHT_BUCKET_SHIFT единиц
+// 10000*log10(lux), ~0.4 декады. Ступень меняется, когда значение выходит
+// за её границы больше чем на APP_LIGHT_HYSTERESIS
+#define APP_LIGHT_BUCKET_SHIFT  12
+#ifndef APP_LIGHT_HYSTERESIS
+#define APP_LIGHT_HYSTERESIS    512
+#endif
+
+// Уверенность присутствия 0..100 по энергиям ворот инженерного кадра.
+// Пороги ворот 0..8 в единицах энергии радара, 100 - ворота не учитываются
+#ifndef APP_CONFIDENCE_MOVING_GATES
+#define APP_CONFIDENCE_MOVING_GATES  {50, 50, 40, 30, 20, 15, 15, 15, 15}
+#endif
+#ifndef APP_CONFIDENCE_STILL_GATES
+#define APP_CONFIDENCE_STILL_GATES   {100, 100, 40, 40, 30, 30, 20, 20, 20}
+#endif
+// Сглаживание: вес нового кадра 1/2^APP_CONFIDENCE_SHIFT, ~1.6 с при 10 кадрах/с
+#ifndef APP_CONFIDENCE_SHIFT
+#define APP_CONFIDENCE_SHIFT         4
+#endif
+// Присутствие снимается, когда уверенность ниже порога на APP_CONFIDENCE_HYSTERESIS
+#ifndef APP_CONFIDENCE_HYSTERESIS
+#define APP_CONFIDENCE_HYSTERESIS    5
+#endif
+// Отчёт об уверенности при изменении не меньше чем на шаг
+#ifndef APP_CONFIDENCE_REPORT_STEP
+#define APP_CONFIDENCE_REPORT_STEP   10
+#endif
+// Без инженерных кадров дольше APP_CONFIDENCE_TIMEOUT уверенность затухает,
+// как от пустых кадров раз в APP_CONFIDENCE_DECAY_PERIOD, мс
+#ifndef APP_CONFIDENCE_TIMEOUT
+#define APP_CONFIDENCE_TIMEOUT       ((uint32) 1000)
+#endif
+#ifndef APP_CONFIDENCE_DECAY_PERIOD
+#define APP_CONFIDENCE_DECAY_PERIOD  ((uint32) 100)
+#endif
+
+// Освещённость по байту радара в люксах, байт не откалиброван
+#ifndef APP_RADAR_LUX
+#define APP_RADAR_LUX(value)    ((uint32)(value))
+#endif
+
+// Флаги изменённых полей application_config_t
+#define CONFIG_DIRTY_SENSOR_ENABLED       0x0001
+#define CONFIG_DIRTY_THRESHOLD            0x0002
+#define CONFIG_DIRTY_TIME_LOW             0x0004
+#define CONFIG_DIRTY_TIME_HIGH            0x0008
+#define CONFIG_DIRTY_LED_MODE             0x0010
+#define CONFIG_DIRTY_MEASUREMENT_PERIOD   0x0020
+#define CONFIG_DIRTY_OUT_DEBOUNCE         0x0040
+#define CONFIG_DIRTY_LED_BRIGHTNESS       0x0080
+#define CONFIG_DIRTY_LED_ADAPTIVE         0x0100
+#define CONFIG_DIRTY_CONFIDENCE_THRESHOLD 0x0200
+#define CONFIG_DIRTY_ALL                  0xFFFF
 
 #define FIRST_ENDPOINT          1
 #define SECOND_ENDPOINT         2
@@ -37,12 +110,18 @@ extern "C" {
 #define FIRST_ENDPOINT            1
 #define SECOND_ENDPOINT           2
 #define THIRD_ENDPOINT            3
+#define FOURTH_ENDPOINT           4 // только с CO2_SENSOR
 
 /*********************************************************************
  * MACROS
  */
 #define NW_APP_CONFIG 0x0402
 
+// Версия раскладки application_config_t. При добавлении полей увеличить
+// и добавить запись в zclApp_ConfigSchema
+#define APP_CONFIG_VERSION  6
+#define APP_NV_MAGIC        0xC5
+
 #define R ACCESS_CONTROL_READ
 // ACCESS_CONTROL_AUTH_WRITE
 #define RW  (R  | ACCESS_CONTROL_WRITE | ACCESS_CONTROL_AUTH_WRITE)
@@ -56,12 +135,58 @@ extern "C" {
 #define ILLUMINANCE     ZCL_CLUSTER_ID_MS_ILLUMINANCE_MEASUREMENT
 #define ILLUMINANCE_LVL ZCL_CLUSTER_ID_MS_ILLUMINANCE_LEVEL_SENSING_CONFIG
 #define GEN_TIME        ZCL_CLUSTER_ID_GEN_TIME
+#define DIAGNOSTIC      ZCL_CLUSTER_ID_HA_DIAGNOSTIC
+#define CO2             0x040D
+#define MANU_CLUSTER    0xFC00
+
+// Код производителя в командах MANU_CLUSTER. Кластер 0xFC00 уже из диапазона
+// производителя, поэтому кода нет и zcl_SendCommand не ставит бит manufacturer
+// specific. Тип кадра остаётся cluster specific: иначе команда 0x00 - Read Attributes
+#define MANU_CLUSTER_CODE 0x0000
+
+// Команды кластера MANU_CLUSTER
+#define COMMAND_MANU_GET_HISTORY    0x00  // клиент -> сервер: uint16 seq
+#define COMMAND_MANU_HISTORY_PAGE   0x00  // сервер -> клиент: страница истории
+#define COMMAND_MANU_LOG_RECORDS    0x01  // сервер -> клиент: записи лога
+
+// Атрибуты статистики кластера MANU_CLUSTER
+#define ATTRID_STATS_OCCUPIED_TODAY       0x0000
+#define ATTRID_STATS_OCCUPIED_YESTERDAY   0x0001
+#define ATTRID_STATS_SESSIONS             0x0002
+#define ATTRID_STATS_LONGEST_SESSION      0x0003
+#define ATTRID_STATS_RADAR_FRAMES         0x0004
+#define ATTRID_STATS_COMMANDS_EP1         0x0005
+#define ATTRID_STATS_COMMANDS_EP2         0x0006
+#define ATTRID_STATS_COMMANDS_EP3         0x0007
+#define ATTRID_STATS_NV_WRITES            0x0008
+
+// Атрибуты подстройки часов кластера MANU_CLUSTER
+#define ATTRID_CLOCK_DRIFT                0x0010  // 1/256 ppm
+#define ATTRID_CLOCK_SYNC_INTERVAL        0x0011  // мс
+#define ATTRID_TIME_REQUESTS              0x0012
+#define ATTRID_TIME_RESPONSES             0x0013
+
+// Атрибуты лога по радио кластера MANU_CLUSTER
+#define ATTRID_LOG_LEVEL                  0x0014  // записавший становится подписчиком
+#define ATTRID_LOG_DROPPED                0x0015
+
+#define ATTRID_CO2_MEASURED_VALUE                         0x0000  // ppm / 10^6, ZCL_SINGLE
 
 #define ATTRID_LED_MODE                                   0xF004
 #define ATTRID_MS_OCCUPANCY_TARGET_DISTANCE               0xF005
 #define ATTRID_MS_OCCUPANCY_TARGET_TYPE                   0xF006
 #define ATTRID_MS_DISTANCE_MEASUREMENT_PERIOD             0xF007
 #define ATTRID_ILLUMINANCE_THRESHOLD                      0xF001
+#define ATTRID_NV_WRITE_COUNT                             0xF008
+#define ATTRID_TIME_DAY_START                             0xF009  // секунда местных суток
+#define ATTRID_TIME_DAY_END                               0xF00A
+#define ATTRID_MS_OCCUPANCY_OUT_DEBOUNCE                  0xF00B  // мс
+#define ATTRID_MS_OCCUPANCY_OUT_GLITCHES                  0xF00C
+#define ATTRID_MS_OCCUPANCY_DETECTION_LATENCY             0xF00D  // мс
+#define ATTRID_LED_BRIGHTNESS                             0xF00E
+#define ATTRID_LED_ADAPTIVE                               0xF00F
+#define ATTRID_MS_OCCUPANCY_CONFIDENCE                    0xF014  // 0..100
+#define ATTRID_MS_OCCUPANCY_CONFIDENCE_THRESHOLD          0xF015  // 0 - по выходу OUT
   
 #define ZCL_UINT8       ZCL_DATATYPE_UINT8
 #define ZCL_UINT16      ZCL_DATATYPE_UINT16
@@ -92,13 +217,38 @@ typedef enum {
 
 typedef struct {
     bool      SensorEnabled;
-    uint16    Threshold;
+    uint16    Threshold;            // в единицах MeasuredValue, 10000*log10(lux)+1
     uint32    TimeLow;
     uint32    TimeHigh;
     LedMode_t LedMode;
     uint16    MeasurementPeriod;
+    uint16    OutDebounce;  // окно антидребезга выхода OUT, мс
+    uint8     LedBrightness;
+    bool      LedAdaptive;  // яркость диода по освещённости
+    uint8     ConfidenceThreshold;  // присутствие по уверенности, 0 - по выходу OUT
 } application_config_t;
 
+// Заголовок образа настроек во флеш
+typedef struct {
+    uint8     Magic;
+    uint8     Version;      // версия раскладки настроек
+    uint8     Length;       // размер настроек этой версии
+    uint16    Crc;          // CRC16 настроек
+    uint32    WriteCount;   // счётчик записей образа
+} app_nv_header_t;
+
+typedef struct {
+    app_nv_header_t      Header;
+    application_config_t Config;
+} app_nv_image_t;
+
+// Описание одной версии настроек. Upgrade переводит настройки в следующую
+// версию на месте; NULL, если поля только добавлялись в конец
+typedef struct {
+    uint8     Size;
+    void      (*Upgrade)(uint8 *config);
+} app_config_schema_t;
+
 /*********************************************************************
  * VARIABLES
  */
@@ -115,6 +265,12 @@ extern SimpleDescriptionFormat_t zclApp_ThirdEP;
 extern CONST zclAttrRec_t zclApp_AttrsThirdEP[];
 extern CONST uint8 zclApp_AttrsThirdEPCount;
 
+#ifdef CO2_SENSOR
+extern SimpleDescriptionFormat_t zclApp_FourthEP;
+extern CONST zclAttrRec_t zclApp_AttrsFourthEP[];
+extern CONST uint8 zclApp_AttrsFourthEPCount;
+#endif
+
 
 extern const uint8 zclApp_ManufacturerName[];
 extern const uint8 zclApp_ModelId[];
@@ -128,12 +284,19 @@ extern bool    zclApp_NightOutput;
 extern bool    zclApp_Led; 
 
 extern uint16  zclApp_Distance;
+extern uint16  zclApp_DetectionLatency;
+extern uint8   zclApp_Confidence;
 extern TargetType_t zclApp_TargetType;
 
 extern application_config_t zclApp_Config;
 
+extern CONST app_config_schema_t zclApp_ConfigSchema[];
+
+extern uint32 zclApp_GenTime_Time;
 extern uint32 zclApp_GenTime_LocalTime;
 
+extern uint32 zclApp_NvWriteCount;
+
 // APP_TODO: Declare application specific attributes here
 
 /*********************************************************************
@@ -7,8 +7,17 @@
 #include "zcl_general.h"
 #include "zcl_ha.h"
 #include "zcl_ms.h"
+#include "zcl_diagnostic.h"
 
 #include "zcl_app.h"
+#include "stats.h"
+#include "clock_sync.h"
+#include "time_client.h"
+#include "log_stream.h"
+#include "diagnostics.h"
+#include "co2.h"
+#include "hal_key.h"
+#include "utils.h"
 
 #include "version.h"
 
@@ -16,6 +25,8 @@
 #include "bdb_touchlink_target.h"
 #include "stub_aps.h"
 
+#include <stddef.h>
+
 /*********************************************************************
  * CONSTANTS
  */
@@ -43,13 +54,17 @@ const uint16 zclApp_clusterRevision_all = 0x0002;
 
 
 bool    zclApp_Occupied = FALSE; 
-uint16  zclApp_IlluminanceSensor_MeasuredValue = 0;
+uint16  zclApp_IlluminanceSensor_MeasuredValue = 0xFFFF; // до первого измерения
 bool    zclApp_DayOutput = FALSE;
 bool    zclApp_NightOutput = FALSE;
+uint32  zclApp_GenTime_Time = 0;
 uint32  zclApp_GenTime_LocalTime = 0;
 bool    zclApp_Led = FALSE;
 uint16  zclApp_Distance = 0;
 TargetType_t  zclApp_TargetType = TARGET_NONE;
+uint32  zclApp_NvWriteCount = 0;
+uint16  zclApp_DetectionLatency = 0;
+uint8   zclApp_Confidence = 0;
 
 // Basic Cluster
 const uint8 zclApp_HWRevision = APP_HWVERSION;
@@ -63,11 +78,15 @@ const uint8 zclApp_PowerSource = POWER_SOURCE_MAINS_1_PHASE;
 
 
 #define DEFAULT_SensorEnabled       TRUE
-#define DEFAULT_Threshold           (uint16)25000
+#define DEFAULT_Threshold           (uint16)20001 // 100 лк, достижимо и по байту радара
 #define DEFAULT_TimeLow             (uint32)28800
 #define DEFAULT_TimeHigh            (uint32)82800
 #define DEFAULT_LedMode             LED_ALWAYS
 #define DEFAULT_MeasurementPeriod   15
+#define DEFAULT_OutDebounce         25
+#define DEFAULT_LedBrightness       255
+#define DEFAULT_LedAdaptive         TRUE
+#define DEFAULT_ConfidenceThreshold 0
 
 
 application_config_t zclApp_Config = {
@@ -77,6 +96,30 @@ application_config_t zclApp_Config = {
     .TimeHigh =           DEFAULT_TimeHigh,
     .LedMode =            DEFAULT_LedMode,
     .MeasurementPeriod =  DEFAULT_MeasurementPeriod,
+    .OutDebounce =        DEFAULT_OutDebounce,
+    .LedBrightness =      DEFAULT_LedBrightness,
+    .LedAdaptive =        DEFAULT_LedAdaptive,
+    .ConfidenceThreshold = DEFAULT_ConfidenceThreshold,
+};
+
+// Версии настроек, индекс = версия - 1. Размер текущей версии берётся
+// из sizeof, размеры прошлых версий фиксируются смещением первого
+// добавленного в следующей версии поля.
+// Версия 1 - раскладка первых прошивок, они хранили её без заголовка
+// Версия 2 - OutDebounce
+// Версия 3 - LedBrightness
+// Версия 4 - LedAdaptive
+// Версия 5 - Threshold в единицах 10000*log10(lux)+1
+// Версия 6 - ConfidenceThreshold
+static void zclApp_UpgradeThreshold(uint8 *config);
+
+CONST app_config_schema_t zclApp_ConfigSchema[APP_CONFIG_VERSION] = {
+    {offsetof(application_config_t, OutDebounce), NULL},
+    {offsetof(application_config_t, LedBrightness), NULL},
+    {offsetof(application_config_t, LedAdaptive), NULL},
+    {offsetof(application_config_t, ConfidenceThreshold), zclApp_UpgradeThreshold},
+    {offsetof(application_config_t, ConfidenceThreshold), NULL},
+    {sizeof(application_config_t), NULL},
 };
 
 
@@ -95,6 +138,7 @@ CONST zclAttrRec_t zclApp_AttrsFirstEP[] = {
     {BASIC, {ATTRID_BASIC_POWER_SOURCE, ZCL_DATATYPE_ENUM8, R, (void *)&zclApp_PowerSource}},
     {BASIC, {ATTRID_BASIC_SW_BUILD_ID, ZCL_DATATYPE_CHAR_STR, R, (void *)zclApp_DateCode}},
     {BASIC, {ATTRID_CLUSTER_REVISION, ZCL_UINT16, R, (void *)&zclApp_clusterRevision_all}},
+    {BASIC, {ATTRID_NV_WRITE_COUNT, ZCL_UINT32, R, (void *)&zclApp_NvWriteCount}},
 
     {GEN_ON_OFF, {ATTRID_ON_OFF, ZCL_BOOLEAN, RWR, (void *)&zclApp_Config.SensorEnabled}},
     {GEN_ON_OFF, {ATTRID_CLUSTER_REVISION, ZCL_INT16, RW, (void *)&zclApp_clusterRevision_all}},
@@ -103,13 +147,52 @@ CONST zclAttrRec_t zclApp_AttrsFirstEP[] = {
     {OCCUPANCY, {ATTRID_MS_OCCUPANCY_TARGET_DISTANCE, ZCL_UINT16, RR, (void *)&zclApp_Distance}},
     {OCCUPANCY, {ATTRID_MS_OCCUPANCY_TARGET_TYPE, ZCL_DATATYPE_ENUM8, RR, (void *)&zclApp_TargetType}},
     {OCCUPANCY, {ATTRID_MS_DISTANCE_MEASUREMENT_PERIOD, ZCL_UINT16, RW, (void *)&zclApp_Config.MeasurementPeriod}},
+    {OCCUPANCY, {ATTRID_MS_OCCUPANCY_OUT_DEBOUNCE, ZCL_UINT16, RW, (void *)&zclApp_Config.OutDebounce}},
+    {OCCUPANCY, {ATTRID_MS_OCCUPANCY_OUT_GLITCHES, ZCL_UINT32, R, (void *)&Hal_KeyGlitches[0]}},
+    {OCCUPANCY, {ATTRID_MS_OCCUPANCY_DETECTION_LATENCY, ZCL_UINT16, R, (void *)&zclApp_DetectionLatency}},
+    {OCCUPANCY, {ATTRID_MS_OCCUPANCY_CONFIDENCE, ZCL_UINT8, RR, (void *)&zclApp_Confidence}},
+    {OCCUPANCY, {ATTRID_MS_OCCUPANCY_CONFIDENCE_THRESHOLD, ZCL_UINT8, RW, (void *)&zclApp_Config.ConfidenceThreshold}},
     
     {ILLUMINANCE, {ATTRID_MS_ILLUMINANCE_MEASURED_VALUE, ZCL_UINT16, RR, (void *)&zclApp_IlluminanceSensor_MeasuredValue}},
     {ILLUMINANCE, {ATTRID_ILLUMINANCE_THRESHOLD, ZCL_UINT16, RW, (void *)&zclApp_Config.Threshold}},
 
+    {GEN_TIME, {ATTRID_TIME_TIME, ZCL_DATATYPE_UTC, R, (void *)&zclApp_GenTime_Time}},
+    {GEN_TIME, {ATTRID_TIME_STATUS, ZCL_BITMAP8, R, (void *)&zclTimeClient_Status}},
+    {GEN_TIME, {ATTRID_TIME_ZONE, ZCL_INT32, R, (void *)&zclClock_TimeZone}},
+    {GEN_TIME, {ATTRID_TIME_DST_START, ZCL_UINT32, R, (void *)&zclClock_DstStart}},
+    {GEN_TIME, {ATTRID_TIME_DST_END, ZCL_UINT32, R, (void *)&zclClock_DstEnd}},
+    {GEN_TIME, {ATTRID_TIME_DST_SHIFT, ZCL_INT32, R, (void *)&zclClock_DstShift}},
     {GEN_TIME, {ATTRID_TIME_LOCAL_TIME, ZCL_UINT32, RW, (void *)&zclApp_GenTime_LocalTime}},
-    {GEN_TIME, {ATTRID_TIME_DST_START, ZCL_UINT32, RW, (void *)&zclApp_Config.TimeLow}},
-    {GEN_TIME, {ATTRID_TIME_DST_END, ZCL_UINT32, RW, (void *)&zclApp_Config.TimeHigh}}
+    {GEN_TIME, {ATTRID_TIME_DAY_START, ZCL_UINT32, RW, (void *)&zclApp_Config.TimeLow}},
+    {GEN_TIME, {ATTRID_TIME_DAY_END, ZCL_UINT32, RW, (void *)&zclApp_Config.TimeHigh}},
+
+    {DIAGNOSTIC, {ATTRID_DIAGNOSTIC_LAST_MESSAGE_LQI, ZCL_UINT8, RR, (void *)&zclDiagnostics.ParentLqi}},
+    {DIAGNOSTIC, {ATTRID_DIAGNOSTIC_LAST_MESSAGE_RSSI, ZCL_INT8, R, (void *)&zclDiagnostics.ParentRssi}},
+    {DIAGNOSTIC, {ATTRID_DIAGNOSTIC_MAC_TX_UCAST_FAIL, ZCL_UINT16, R, (void *)&zclDiagnostics.MacTxFail}},
+    {DIAGNOSTIC, {ATTRID_DIAGNOSTIC_APS_TX_UCAST_SUCCESS, ZCL_UINT16, R, (void *)&zclDiagnostics.ApsTxSuccess}},
+    {DIAGNOSTIC, {ATTRID_DIAGNOSTIC_APS_TX_UCAST_FAIL, ZCL_UINT16, RR, (void *)&zclDiagnostics.ApsTxFail}},
+    {DIAGNOSTIC, {ATTRID_DIAGNOSTIC_WORST_NEIGHBOR_LQI, ZCL_UINT8, RR, (void *)&zclDiagnostics.WorstNeighborLqi}},
+    {DIAGNOSTIC, {ATTRID_DIAGNOSTIC_WORST_NEIGHBOR_ADDR, ZCL_UINT16, R, (void *)&zclDiagnostics.WorstNeighborAddr}},
+    {DIAGNOSTIC, {ATTRID_DIAGNOSTIC_CONFIRM_LATENCY, ZCL_UINT16, R, (void *)&zclDiagnostics.ConfirmLatency}},
+    {DIAGNOSTIC, {ATTRID_DIAGNOSTIC_CONFIRM_LATENCY_MAX, ZCL_UINT16, RR, (void *)&zclDiagnostics.ConfirmLatencyMax}},
+
+    {MANU_CLUSTER, {ATTRID_STATS_OCCUPIED_TODAY, ZCL_UINT32, R, (void *)&zclStats.OccupiedToday}},
+    {MANU_CLUSTER, {ATTRID_STATS_OCCUPIED_YESTERDAY, ZCL_UINT32, R, (void *)&zclStats.OccupiedYesterday}},
+    {MANU_CLUSTER, {ATTRID_STATS_SESSIONS, ZCL_UINT32, R, (void *)&zclStats.Sessions}},
+    {MANU_CLUSTER, {ATTRID_STATS_LONGEST_SESSION, ZCL_UINT32, R, (void *)&zclStats.LongestSession}},
+    {MANU_CLUSTER, {ATTRID_STATS_RADAR_FRAMES, ZCL_UINT32, R, (void *)&zclStats.RadarFrames}},
+    {MANU_CLUSTER, {ATTRID_STATS_COMMANDS_EP1, ZCL_UINT32, R, (void *)&zclStats.Commands[0]}},
+    {MANU_CLUSTER, {ATTRID_STATS_COMMANDS_EP2, ZCL_UINT32, R, (void *)&zclStats.Commands[1]}},
+    {MANU_CLUSTER, {ATTRID_STATS_COMMANDS_EP3, ZCL_UINT32, R, (void *)&zclStats.Commands[2]}},
+    {MANU_CLUSTER, {ATTRID_STATS_NV_WRITES, ZCL_UINT32, R, (void *)&zclStats.NvWrites}},
+
+    {MANU_CLUSTER, {ATTRID_CLOCK_DRIFT, ZCL_INT32, R, (void *)&zclClock_Drift}},
+    {MANU_CLUSTER, {ATTRID_CLOCK_SYNC_INTERVAL, ZCL_UINT32, R, (void *)&zclClock_SyncInterval}},
+    {MANU_CLUSTER, {ATTRID_TIME_REQUESTS, ZCL_UINT32, R, (void *)&zclTimeClient_Requests}},
+    {MANU_CLUSTER, {ATTRID_TIME_RESPONSES, ZCL_UINT32, R, (void *)&zclTimeClient_Responses}},
+
+    {MANU_CLUSTER, {ATTRID_LOG_LEVEL, ZCL_UINT8, RW, (void *)&zclLogStream_Level}},
+    {MANU_CLUSTER, {ATTRID_LOG_DROPPED, ZCL_UINT32, R, (void *)&zclLogStream_Dropped}}
 };
 
 CONST zclAttrRec_t zclApp_AttrsSecondEP[] = {
@@ -119,11 +202,21 @@ CONST zclAttrRec_t zclApp_AttrsSecondEP[] = {
 CONST zclAttrRec_t zclApp_AttrsThirdEP[] = {
     {GEN_ON_OFF, {ATTRID_ON_OFF, ZCL_BOOLEAN, RWR, (void *)&zclApp_NightOutput}},
     {GEN_ON_OFF, {ATTRID_LED_MODE, ZCL_DATATYPE_ENUM8, RW, (void *)&zclApp_Config.LedMode}},
+    {GEN_ON_OFF, {ATTRID_LED_BRIGHTNESS, ZCL_UINT8, RW, (void *)&zclApp_Config.LedBrightness}},
+    {GEN_ON_OFF, {ATTRID_LED_ADAPTIVE, ZCL_BOOLEAN, RW, (void *)&zclApp_Config.LedAdaptive}},
 };
 
 uint8 CONST zclApp_AttrsFirstEPCount = (sizeof(zclApp_AttrsFirstEP) / sizeof(zclApp_AttrsFirstEP[0]));
 uint8 CONST zclApp_AttrsSecondEPCount = (sizeof(zclApp_AttrsSecondEP) / sizeof(zclApp_AttrsSecondEP[0]));
 uint8 CONST zclApp_AttrsThirdEPCount = (sizeof(zclApp_AttrsThirdEP) / sizeof(zclApp_AttrsThirdEP[0]));
+
+#ifdef CO2_SENSOR
+CONST zclAttrRec_t zclApp_AttrsFourthEP[] = {
+    {CO2, {ATTRID_CO2_MEASURED_VALUE, ZCL_SINGLE, RR, (void *)&zclCO2_MeasuredValue}},
+};
+
+uint8 CONST zclApp_AttrsFourthEPCount = (sizeof(zclApp_AttrsFourthEP) / sizeof(zclApp_AttrsFourthEP[0]));
+#endif
  
 const cId_t zclApp_InClusterListFirstEP[] = {
   BASIC,
@@ -133,7 +226,9 @@ const cId_t zclApp_InClusterListFirstEP[] = {
   OCCUPANCY, 
   ILLUMINANCE,
   ILLUMINANCE_LVL,
-  GEN_TIME
+  GEN_TIME,
+  DIAGNOSTIC,
+  MANU_CLUSTER
 };
 
 #define APP_MAX_IN_CLUSTERS_FIRST_EP (sizeof(zclApp_InClusterListFirstEP) / sizeof(zclApp_InClusterListFirstEP[0]))
@@ -173,6 +268,14 @@ const cId_t zclApp_OutClusterListThirdEP[] = {
 
 #define APP_MAX_OUT_CLUSTERS_THIRD_EP (sizeof(zclApp_OutClusterListThirdEP) / sizeof(zclApp_OutClusterListThirdEP[0]))
 
+#ifdef CO2_SENSOR
+const cId_t zclApp_InClusterListFourthEP[] = {
+  CO2
+};
+
+#define APP_MAX_IN_CLUSTERS_FOURTH_EP (sizeof(zclApp_InClusterListFourthEP) / sizeof(zclApp_InClusterListFourthEP[0]))
+#endif
+
 
 SimpleDescriptionFormat_t zclApp_FirstEP = {
     FIRST_ENDPOINT,                             //  int Endpoint;
@@ -210,6 +313,27 @@ SimpleDescriptionFormat_t zclApp_ThirdEP = {
     (cId_t *)zclApp_OutClusterListThirdEP       //  byte *pAppInClusterList;
 };
 
+#ifdef CO2_SENSOR
+SimpleDescriptionFormat_t zclApp_FourthEP = {
+    FOURTH_ENDPOINT,                            //  int Endpoint;
+    ZCL_HA_PROFILE_ID,                          //  uint16 AppProfId[2];
+    ZCL_HA_DEVICEID_SIMPLE_SENSOR,              //  uint16 AppDeviceId[2];
+    APP_DEVICE_VERSION,                         //  int   AppDevVer:4;
+    APP_FLAGS,                                  //  int   AppFlags:4;
+    APP_MAX_IN_CLUSTERS_FOURTH_EP,              //  byte  AppNumInClusters;
+    (cId_t *)zclApp_InClusterListFourthEP,      //  byte *pAppInClusterList;
+    0,                                          //  byte  AppNumInClusters;
+    (cId_t *)NULL                               //  byte *pAppInClusterList;
+};
+#endif
+
+
+// До версии 5 порог хранился в единицах байта радара * 155
+static void zclApp_UpgradeThreshold(uint8 *config) {
+    application_config_t *cfg = (application_config_t *)config;
+
+    cfg->Threshold = luxToZclIlluminance(cfg->Threshold / 155);
+}
 
 void zclApp_ResetAttributesToDefaultValues(void) {
     zclApp_Config.SensorEnabled =     DEFAULT_SensorEnabled;
@@ -218,5 +342,9 @@ void zclApp_ResetAttributesToDefaultValues(void) {
     zclApp_Config.TimeHigh =          DEFAULT_TimeHigh;
     zclApp_Config.LedMode =           DEFAULT_LedMode;
     zclApp_Config.MeasurementPeriod = DEFAULT_MeasurementPeriod;
+    zclApp_Config.OutDebounce =       DEFAULT_OutDebounce;
+    zclApp_Config.LedBrightness =     DEFAULT_LedBrightness;
+    zclApp_Config.LedAdaptive =       DEFAULT_LedAdaptive;
+    zclApp_Config.ConfidenceThreshold = DEFAULT_ConfidenceThreshold;
 }
 
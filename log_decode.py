@@ -0,0 +1,198 @@
+"""Decodes the tokenized debug log (see zstack-lib/Debug.h) back to text.
+
+The dictionary is built from the sources, so they must match the firmware:
+a token is the log module of the file and the line of the LREP call.
+The firmware logs the checksum of its table (see table_id, written into
+Source/version.c by ver.py), a capture from other sources is refused.
+
+    python log_decode.py capture.bin
+    python log_decode.py --port COM3          (needs pyserial)
+    python log_decode.py --hex frames.txt     (payloads of over-the-air log frames)
+"""
+import argparse
+import re
+import struct
+import sys
+import zlib
+from os import walk
+from os.path import dirname, join, relpath
+
+cwd = dirname(__file__)
+SOURCE_DIRS = ['Source', 'zstack-lib']
+
+SYNC = 0xA5
+ARGC_DUMP = 0x80
+TOKEN_DROPPED = 0x0000
+TOKEN_BUILD = 0x0001
+
+CALL_RE = re.compile(r'\b(LREP|LREPMaster|LREPDump|LOG_ERROR|LOG_WARN|LOG_INFO|LOG_TRACE|LOG_DUMP)\s*\(')
+STRING_RE = re.compile(r'"((?:[^"\\]|\\.)*)"')
+CONVERSION_RE = re.compile(r'%([-+ #0]*\d*(?:\.\d+)?)(hh|h|ll|l)?([diouxXcsp%])')
+
+
+def read_modules():
+    modules = {}
+    with open(join(cwd, 'zstack-lib', 'Debug.h')) as f:
+        for name, value in re.findall(r'(LOG_MODULE_\w+)\s*=\s*(\d+)', f.read()):
+            modules[name] = int(value)
+    return modules
+
+
+ESCAPES = {'n': '\n', 'r': '\r', 't': '\t', '0': '\0'}
+
+
+def unescape(literal):
+    def replace(match):
+        escape = match.group(1)
+        if escape[0] == 'x':
+            return chr(int(escape[1:], 16))
+        return ESCAPES.get(escape, escape)
+
+    return re.sub(r'\\(x[0-9a-fA-F]{1,2}|.)', replace, literal)
+
+
+def call_end(text, start):
+    depth = 0
+    i = start
+    while i < len(text):
+        c = text[i]
+        if c == '"':
+            i = STRING_RE.match(text, i).end()
+            continue
+        if c == '(':
+            depth += 1
+        elif c == ')':
+            depth -= 1
+            if depth == 0:
+                return i
+        i += 1
+    return len(text) - 1
+
+
+def build_dictionary():
+    modules = read_modules()
+    tokens = {}
+    for source_dir in SOURCE_DIRS:
+        for root, _, files in walk(join(cwd, source_dir)):
+            for name in files:
+                if not name.endswith('.c'):
+                    continue
+                path = join(root, name)
+                with open(path, encoding='utf-8', errors='replace') as f:
+                    text = f.read()
+                match = re.search(r'#define\s+LOG_MODULE\s+(LOG_MODULE_\w+)', text)
+                module = modules.get(match.group(1), 0) if match else 0
+                for call in CALL_RE.finditer(text):
+                    end = call_end(text, call.end() - 1)
+                    args = text[call.end():end]
+                    literal = re.match(r'\s*((?:"(?:[^"\\]|\\.)*"\s*)+)', args)
+                    fmt = ''.join(unescape(s) for s in STRING_RE.findall(literal.group(1))) if literal else args.strip()
+                    entry = (call.group(1), fmt, '%s:%d' % (relpath(path, cwd), text.count('\n', 0, call.start()) + 1))
+                    # only the pointer of a string would reach the log
+                    if any(c.group(3) == 's' for c in CONVERSION_RE.finditer(fmt)):
+                        sys.exit('%s: %%s in a tokenized log call, log numbers instead' % entry[2])
+                    # the compiler may report any line of a call that spans several
+                    for line in range(text.count('\n', 0, call.start()) + 1, text.count('\n', 0, end) + 2):
+                        tokens[(module << 11) | (line & 0x07FF)] = entry
+    return tokens
+
+
+def table_id(tokens):
+    # paths are left out, the id must not depend on the checkout
+    table = ''.join('%04X %s %s\n' % (token, tokens[token][0], tokens[token][1]) for token in sorted(tokens))
+    return zlib.crc32(table.encode('utf-8')) & 0xFFFFFFFF
+
+
+def format_record(fmt, args):
+    values = iter(args)
+
+    def convert(match):
+        flags, length, kind = match.groups()
+        if kind == '%':
+            return '%'
+        value = next(values, 0)
+        if length not in ('l', 'll'):
+            value &= 0xFFFF  # int is 16 bit on the 8051
+            if kind in 'di' and value & 0x8000:
+                value -= 0x10000
+        elif kind in 'di' and value & 0x80000000:
+            value -= 0x100000000
+        if kind == 'c':
+            return chr(value & 0xFF)
+        if kind == 'p':
+            return '<0x%06X>' % (value & 0xFFFFFF)
+        return ('%' + flags + kind.replace('u', 'd')) % value
+
+    return CONVERSION_RE.sub(convert, fmt)
+
+
+def decode(read, tokens, out):
+    expected = table_id(tokens)
+    buf = bytearray()
+    while True:
+        chunk = read()
+        if not chunk:
+            break
+        buf += chunk
+        while True:
+            start = buf.find(bytes([SYNC]))
+            if start < 0:
+                buf.clear()
+                break
+            del buf[:start]
+            if len(buf) < 4:
+                break
+            token, argc = struct.unpack_from('<HB', buf, 1)
+            size = 4 + (argc & ~ARGC_DUMP if argc & ARGC_DUMP else argc * 4)
+            if len(buf) < size:
+                break
+            payload = bytes(buf[4:size])
+            del buf[:size]
+
+            if token == TOKEN_DROPPED:
+                out.write('--- %d records dropped ---\n' % struct.unpack('<I', payload)[0])
+                continue
+            if token == TOKEN_BUILD:
+                built = struct.unpack('<I', payload)[0]
+                if built != expected:
+                    out.flush()
+                    sys.exit('firmware token table 0x%08X, sources give 0x%08X: check out the sources of that build'
+                             % (built, expected))
+                continue
+            kind, fmt, where = tokens.get(token, (None, None, None))
+            if kind is None:
+                out.write('<unknown token 0x%04X>\n' % token)
+            elif argc & ARGC_DUMP:
+                out.write(' '.join('0x%X' % b for b in payload) + '\n')
+            else:
+                args = struct.unpack('<%dI' % argc, payload)
+                out.write(format_record(fmt, args))
+            out.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode the tokenized debug log')
+    parser.add_argument('capture', nargs='?', help='binary capture file, stdin if omitted')
+    parser.add_argument('--port', help='serial port to read from')
+    parser.add_argument('--baud', type=int, default=115200)
+    parser.add_argument('--hex', action='store_true', help='input is hex text, e.g. log frame payloads one per line')
+    args = parser.parse_args()
+
+    tokens = build_dictionary()
+    if args.port:
+        import serial
+        port = serial.Serial(args.port, args.baud, timeout=None)
+        read = lambda: port.read(max(1, port.in_waiting))
+    else:
+        stream = open(args.capture, 'rb') if args.capture else sys.stdin.buffer
+        read = lambda: stream.read(64)
+        if args.hex:
+            # an empty chunk ends decode, blank lines are skipped
+            chunks = (bytes(int(x, 16) for x in re.split(r'[\s,]+', line.decode().strip()))
+                      for line in stream if line.strip())
+            read = lambda: next(chunks, b'')
+    decode(read, tokens, sys.stdout)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,145 @@
+/*
+ * Host test of the integer math in zstack-lib against the float formulas
+ * it replaced. Build and run from the repository root:
+ *
+ *     gcc -std=c99 -Itools/host -Izstack-lib -include hal_types.h tools/fixed_point_test.c zstack-lib/utils.c -lm -o fixed_point_test
+ *     ./fixed_point_test
+ *
+ * Prints the largest error of each function, exits with 1 if one is out of
+ * its bound.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "hal_adc.h"
+#include "utils.h"
+#include "battery.h"
+
+// utils.c links adcReadSampled, nothing here calls it
+void HalAdcSetReference(uint8 reference) { (void)reference; }
+uint16 HalAdcRead(uint8 channel, uint8 resolution) {
+    (void)channel;
+    (void)resolution;
+    return 0;
+}
+
+static int failures = 0;
+
+static void check(const char *name, double maxError, double bound) {
+    int ok = maxError <= bound;
+    printf("%-24s max error %.4f (bound %.4f) %s\n", name, maxError, bound, ok ? "ok" : "FAIL");
+    if (!ok) {
+        failures++;
+    }
+}
+
+// double mapRange before the integer version
+static double mapRangeFloat(double a1, double a2, double b1, double b2, double s) {
+    double result = b1 + (s - a1) * (b2 - b1) / (a2 - a1);
+    return MIN(b2, MAX(result, b1));
+}
+
+// float getBatteryRemainingPercentageZCLCR2032 before the curve table, without the final cast
+static double cr2032Float(uint16 volt16) {
+    double battery_level;
+    if (volt16 >= 3000) {
+        battery_level = 100;
+    } else if (volt16 > 2900) {
+        battery_level = 100 - ((3000 - volt16) * 58.0) / 100;
+    } else if (volt16 > 2740) {
+        battery_level = 42 - ((2900 - volt16) * 24.0) / 160;
+    } else if (volt16 > 2440) {
+        battery_level = 18 - ((2740 - volt16) * 12.0) / 300;
+    } else if (volt16 > 2100) {
+        battery_level = 6 - ((2440 - volt16) * 6.0) / 340;
+    } else {
+        battery_level = 0;
+    }
+    return battery_level * 2;
+}
+
+static void testMapRange(void) {
+    static const int32 ranges[][4] = {{2000, 3300, 0, 200}, {0, 1000, 0, 255}, {-500, 500, -100, 100}, {3300, 2000, 0, 200}};
+    double maxError = 0;
+
+    for (unsigned r = 0; r < sizeof(ranges) / sizeof(ranges[0]); r++) {
+        for (int32 s = -4000; s <= 4000; s++) {
+            double expected = mapRangeFloat(ranges[r][0], ranges[r][1], ranges[r][2], ranges[r][3], s);
+            int32 actual = mapRange(ranges[r][0], ranges[r][1], ranges[r][2], ranges[r][3], s);
+            maxError = MAX(maxError, fabs(actual - expected));
+        }
+    }
+    // rounded to nearest
+    check("mapRange", maxError, 0.5 + 1e-9);
+}
+
+static void testCurveInterpolate(void) {
+    static CONST curvePoint_t curve[] = BATTERY_CURVE_CR2032;
+    double maxError = 0;
+
+    for (uint32 mv = 0; mv <= 4000; mv++) {
+        double expected = cr2032Float((uint16)mv);
+        uint16 actual = curveInterpolate(curve, sizeof(curve) / sizeof(curve[0]), (uint16)mv);
+        maxError = MAX(maxError, fabs(actual - expected));
+    }
+    // truncated like the (uint8) cast of the float version
+    check("curveInterpolate CR2032", maxError, 1.0);
+}
+
+static void testBatteryVoltage(void) {
+    double maxError = 0;
+
+    // 14-bit conversions are signed, 0..8191
+    for (uint32 raw = 0; raw < 8192; raw++) {
+        double expected = raw * MULTI;
+        maxError = MAX(maxError, fabs(BATTERY_RAW_TO_MILLIVOLTS(raw) - expected));
+    }
+    // Q16 constant is off by at most 2^-17 mV per unit
+    check("MULTI_Q16 millivolts", maxError, 0.5 + 8192.0 / 131072);
+}
+
+static void testLuxToZcl(void) {
+    double maxError = 0;
+    uint32 lux = 1;
+
+    while (1) {
+        double expected = 10000 * log10((double)lux) + 1;
+        if (expected > 0xFFFE) {
+            expected = 0xFFFE;
+        }
+        maxError = MAX(maxError, fabs(luxToZclIlluminance(lux) - expected));
+        if (lux > 0xFFFFFFFFu - lux / 64 - 1) {
+            break;
+        }
+        lux += lux / 64 + 1;
+    }
+    if (luxToZclIlluminance(0) != 0) {
+        maxError = 1e9;
+    }
+    check("luxToZclIlluminance", maxError, 1.1);
+}
+
+static void testRatioToFloat(void) {
+    double maxError = 0;
+
+    for (uint32 ppm = 0; ppm <= 0xFFFF; ppm++) {
+        float expected = (float)((double)ppm / 1000000);
+        uint32 bits;
+        memcpy(&bits, &expected, sizeof(bits));
+        if (ratioToFloat(ppm, 1000000) != bits) {
+            maxError = 1;
+        }
+    }
+    // bit-exact
+    check("ratioToFloat", maxError, 0);
+}
+
+int main(void) {
+    testMapRange();
+    testCurveInterpolate();
+    testBatteryVoltage();
+    testLuxToZcl();
+    testRatioToFloat();
+    return failures ? 1 : 0;
+}
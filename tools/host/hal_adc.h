@@ -0,0 +1,8 @@
+#ifndef HOST_HAL_ADC_H
+#define HOST_HAL_ADC_H
+// Host stand-in for the ADC driver zstack-lib/utils.c links against
+#include "hal_types.h"
+
+extern void HalAdcSetReference(uint8 reference);
+extern uint16 HalAdcRead(uint8 channel, uint8 resolution);
+#endif
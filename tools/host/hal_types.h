@@ -0,0 +1,17 @@
+#ifndef HOST_HAL_TYPES_H
+#define HOST_HAL_TYPES_H
+// Host stand-in for the Z-Stack types, preincluded like preinclude.h on the
+// target because utils.h relies on them. See tools/fixed_point_test.c
+// zstack-lib/stdint.h maps the C99 names to these, so no <stdint.h> here
+typedef unsigned char uint8;
+typedef unsigned short uint16;
+typedef unsigned int uint32;
+typedef signed char int8;
+typedef short int16;
+typedef int int32;
+
+#define CONST const
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+#define MAX(x, y) (((x) > (y)) ? (x) : (y))
+#endif
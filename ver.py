@@ -1,5 +1,6 @@
 from datetime import datetime
 from os.path import dirname, join
+from log_decode import build_dictionary, table_id
 cwd = dirname(__file__)
 now = datetime.now()
 dt_string = now.strftime("%d/%m/%Y %H:%M")
@@ -21,6 +22,11 @@ with open(join(cwd, './Source/version.c'), 'w') as f:
     f.write(code)
     code = """const char zclApp_DateCodeNT[] = \"{0}\";\n""".format(dt_string)
     f.write(code)
+    # the tokenized log sends numbers only, see log_decode.py
+    code = """const uint32 zclApp_DateCodeNumber = {0}UL; // YYMMDDhhmm\n""".format(now.strftime("%y%m%d%H%M"))
+    f.write(code)
+    code = """const uint32 Debug_TableId = 0x{0:08X}UL;\n""".format(table_id(build_dictionary()))
+    f.write(code)
     f.write("""
     #ifdef __cplusplus
     }
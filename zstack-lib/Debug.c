@@ -1,3 +1,4 @@
+#define LOG_MODULE LOG_MODULE_DEBUG
 #include "Debug.h"
 #include "DebugTrace.h"
 #include "MT.h"
@@ -5,16 +6,47 @@
 #include "OSAL_Memory.h"
 
 
+#ifndef DEBUG_TOKENIZED
 void vprint(const char *fmt, va_list argp) {
     uint8 string[100];
     if (0 < vsprintf((char *)string, fmt, argp)) // build string
     {
-        LREPMaster(string);
+        DebugPuts(string);
     }
 }
 
+void DebugDump(uint8 *data, uint8 len) {
+    for (uint8 i = 0; i < len; i++) {
+        DebugPrintf("0x%X ", data[i]);
+    }
+    DebugPuts("\r\n");
+}
+#endif
+
+#ifdef DEBUG_TOKENIZED
+static DebugSink_t Debug_Sink = NULL;
+#ifdef DO_DEBUG_UART
+uint8 Debug_Level = LOG_LEVEL_TRACE; // the UART takes every compiled-in record
+#else
+uint8 Debug_Level = LOG_LEVEL_NONE; // raised by the sink owner
+#endif
+#endif
+
 #ifdef DO_DEBUG_UART
 #define UART_PORT HAL_UART_PORT_0
+
+#ifndef DO_DEBUG_UART_TEXT
+uint16 Debug_Dropped = 0;
+
+// Records wait here until the UART DMA buffer has room for them
+static uint8 Debug_Ring[DEBUG_RING_SIZE];
+static uint16 Debug_Head = 0;
+static uint16 Debug_Tail = 0;
+
+static void DebugFlush(void);
+static void DebugUartCB(uint8 port, uint8 event);
+#endif
+
 bool DebugInit() {
     halUARTCfg_t halUARTConfig;
     halUARTConfig.configured = TRUE;
@@ -26,28 +58,121 @@ bool DebugInit() {
     halUARTConfig.rx.maxBufSize = 0;
     halUARTConfig.tx.maxBufSize = BUFFLEN;
     halUARTConfig.intEnable = TRUE;
+#ifdef DO_DEBUG_UART_TEXT
     halUARTConfig.callBackFunc = NULL;
+#else
+    halUARTConfig.callBackFunc = DebugUartCB;
+#endif
     HalUARTInit();
     if (HalUARTOpen(UART_PORT, &halUARTConfig) == HAL_UART_SUCCESS) {
+#ifndef DO_DEBUG_UART_TEXT
+        DebugLogBuild();
+#endif
         LREPMaster("Initialized debug module \r\n");
         return true;
     }
     return false;
 }
 
-void LREPMaster(uint8 *data) {
+#ifdef DO_DEBUG_UART_TEXT
+void DebugPuts(uint8 *data) {
     if (data == NULL) {
         return;
     }
     HalUARTWrite(UART_PORT, data, osal_strlen((char *)data));
 }
 
-void LREP(char *format, ...) {
+void DebugPrintf(char *format, ...) {
     va_list argp;
     va_start(argp, format);
     vprint(format, argp);
     va_end(argp);
 }
+#else
+static uint16 DebugFree(void) {
+    return (Debug_Tail + DEBUG_RING_SIZE - Debug_Head - 1) % DEBUG_RING_SIZE;
+}
+
+static void DebugPut(uint8 byte) {
+    Debug_Ring[Debug_Head] = byte;
+    Debug_Head = (Debug_Head + 1) % DEBUG_RING_SIZE;
+}
+
+static void DebugPutHeader(uint16 token, uint8 argc) {
+    DebugPut(DEBUG_SYNC);
+    DebugPut(LO_UINT16(token));
+    DebugPut(HI_UINT16(token));
+    DebugPut(argc);
+}
+
+static void DebugPutUint32(uint32 value) {
+    DebugPut(BREAK_UINT32(value, 0));
+    DebugPut(BREAK_UINT32(value, 1));
+    DebugPut(BREAK_UINT32(value, 2));
+    DebugPut(BREAK_UINT32(value, 3));
+}
+
+// Whole record or nothing, a lost record is reported before the next one
+static bool DebugReserve(uint16 len) {
+    if (Debug_Dropped) {
+        if (DebugFree() < len + 8) {
+            Debug_Dropped++;
+            return FALSE;
+        }
+        DebugPutHeader(DEBUG_TOKEN_DROPPED, 1);
+        DebugPutUint32(Debug_Dropped);
+        Debug_Dropped = 0;
+    } else if (DebugFree() < len) {
+        Debug_Dropped++;
+        return FALSE;
+    }
+    return TRUE;
+}
+
+static void DebugUartRecord(uint16 token, uint8 argc, uint8 *data, uint8 len) {
+    halIntState_t intState;
+
+    HAL_ENTER_CRITICAL_SECTION(intState);
+    if (DebugReserve(4 + len)) {
+        DebugPutHeader(token, argc);
+        for (uint8 i = 0; i < len; i++) {
+            DebugPut(data[i]);
+        }
+    }
+    HAL_EXIT_CRITICAL_SECTION(intState);
+    DebugFlush();
+}
+
+// Moves as much of the ring as fits into the UART DMA buffer
+static void DebugFlush(void) {
+    halIntState_t intState;
+    uint16 head, len, room;
+
+    HAL_ENTER_CRITICAL_SECTION(intState);
+    head = Debug_Head;
+    HAL_EXIT_CRITICAL_SECTION(intState);
+
+    while (head != Debug_Tail) {
+        len = (head > Debug_Tail ? head : DEBUG_RING_SIZE) - Debug_Tail;
+        room = Hal_UART_TxBufLen(UART_PORT);
+        if (len > room) {
+            len = room;
+        }
+        if (len == 0 || HalUARTWrite(UART_PORT, &Debug_Ring[Debug_Tail], len) != len) {
+            return;
+        }
+        HAL_ENTER_CRITICAL_SECTION(intState);
+        Debug_Tail = (Debug_Tail + len) % DEBUG_RING_SIZE;
+        HAL_EXIT_CRITICAL_SECTION(intState);
+    }
+}
+
+static void DebugUartCB(uint8 port, uint8 event) {
+    if (event & HAL_UART_TX_EMPTY) {
+        DebugFlush();
+    }
+}
+#endif
 #elif defined(DO_DEBUG_MT)
 
 bool DebugInit() {
@@ -55,23 +180,66 @@ bool DebugInit() {
     LREPMaster("Initialized debug module \r\n");
     return TRUE;
 }
-void LREP(char *format, ...) {
+void DebugPrintf(char *format, ...) {
 
     va_list argp;
     va_start(argp, format);
     vprint(format, argp);
     va_end(argp);
 }
-void LREPMaster(uint8 *data) { debug_str(data); }
+void DebugPuts(uint8 *data) { debug_str(data); }
+#elif defined(DO_DEBUG_OTA)
+// Records only go to the sink
+bool DebugInit() {return true;};
 #else
+// No debug transport, LOG_LEVEL_DEFAULT is LOG_LEVEL_NONE and nothing calls these
 bool DebugInit() {return true;};
-void LREP(char *format, ...) {
+void DebugPrintf(char *format, ...) {
     va_list argp;
     va_start(argp, format);
-    printf(format, argp);
+    vprintf(format, argp);
     va_end(argp);
 };
-void LREPMaster(uint8 *data) {
+void DebugPuts(uint8 *data) {
     printf((const char*)data);
 };
 #endif
+
+#ifdef DEBUG_TOKENIZED
+void DebugSetSink(DebugSink_t sink) { Debug_Sink = sink; }
+
+void DebugSetLevel(uint8 level) {
+#ifndef DO_DEBUG_UART
+    Debug_Level = level;
+#endif
+}
+
+static void DebugRecord(uint8 level, uint16 token, uint8 argc, uint8 *data, uint8 len) {
+    if (Debug_Sink != NULL) {
+        Debug_Sink(level, token, argc, data, len);
+    }
+#ifdef DO_DEBUG_UART
+    DebugUartRecord(token, argc, data, len);
+#endif
+}
+
+void DebugLogToken(uint8 level, uint16 token, uint8 argc, ...) {
+    uint8 args[6 * 4];
+    va_list argp;
+
+    va_start(argp, argc);
+    for (uint8 i = 0; i < argc; i++) {
+        osal_buffer_uint32(&args[i * 4], va_arg(argp, uint32));
+    }
+    va_end(argp);
+    DebugRecord(level, token, argc, args, argc * 4);
+}
+
+// Not filtered by Debug_Level, every subscriber gets the error level
+void DebugLogBuild(void) { DebugLogToken(LOG_LEVEL_ERROR, DEBUG_TOKEN_BUILD, 1, Debug_TableId); }
+
+void DebugLogDump(uint8 level, uint16 token, uint8 *data, uint8 len) {
+    len &= ~DEBUG_ARGC_DUMP;
+    DebugRecord(level, token, DEBUG_ARGC_DUMP | len, data, len);
+}
+#endif
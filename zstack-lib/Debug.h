@@ -33,8 +33,215 @@
 
 extern halUARTCfg_t halUARTConfig;
 
-void vprint(const char *fmt, va_list argp);
+// Log modules, each source file defines LOG_MODULE before including Debug.h.
+// Enum, not macros: LOG_MODULE is pasted into the name of its threshold.
+// log_decode.py reads this list to map tokens back to files
+enum {
+    LOG_MODULE_DEFAULT = 0,
+    LOG_MODULE_APP = 1,
+    LOG_MODULE_HISTORY = 2,
+    LOG_MODULE_STATS = 3,
+    LOG_MODULE_CLOCK = 4,
+    LOG_MODULE_TIME = 5,
+    LOG_MODULE_COMMISSIONING = 6,
+    LOG_MODULE_FACTORY_RESET = 7,
+    LOG_MODULE_BATTERY = 8,
+    LOG_MODULE_KEY = 9,
+    LOG_MODULE_MHZ19 = 10,
+    LOG_MODULE_SENSEAIR = 11,
+    LOG_MODULE_TL_RESETTER = 12,
+    LOG_MODULE_DEBUG = 13,
+    LOG_MODULE_LIGHT = 14,
+    LOG_MODULE_DIAGNOSTICS = 15,
+    LOG_MODULE_CO2 = 16
+};
+
+#ifndef LOG_MODULE
+#define LOG_MODULE LOG_MODULE_DEFAULT
+#endif
+
+#define LOG_CAT(a, b) LOG_CAT_(a, b)
+#define LOG_CAT_(a, b) a##b
+
+/*
+ * Log levels. A call above the threshold of its module expands to nothing,
+ * its arguments are not evaluated. Thresholds are set per module, e.g.
+ * -DLOG_MODULE_APP_LEVEL=LOG_LEVEL_TRACE, or for all with LOG_LEVEL_DEFAULT.
+ * Builds without a debug transport log nothing, DO_DEBUG_OTA is one.
+ */
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_INFO  3
+#define LOG_LEVEL_TRACE 4
+
+#if defined(DO_DEBUG_OTA) && (defined(DO_DEBUG_UART_TEXT) || defined(DO_DEBUG_MT))
+#error "DO_DEBUG_OTA streams tokenized records, it does not work with text output"
+#endif
+
+#if (defined(DO_DEBUG_UART) && !defined(DO_DEBUG_UART_TEXT)) || defined(DO_DEBUG_OTA)
+#define DEBUG_TOKENIZED
+#endif
+
+#ifndef LOG_LEVEL_DEFAULT
+#if defined(DO_DEBUG_UART) || defined(DO_DEBUG_MT) || defined(DO_DEBUG_OTA)
+#define LOG_LEVEL_DEFAULT LOG_LEVEL_INFO
+#else
+#define LOG_LEVEL_DEFAULT LOG_LEVEL_NONE
+#endif
+#endif
+
+#ifndef LOG_MODULE_DEFAULT_LEVEL
+#define LOG_MODULE_DEFAULT_LEVEL LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_MODULE_APP_LEVEL
+#define LOG_MODULE_APP_LEVEL LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_MODULE_HISTORY_LEVEL
+#define LOG_MODULE_HISTORY_LEVEL LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_MODULE_STATS_LEVEL
+#define LOG_MODULE_STATS_LEVEL LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_MODULE_CLOCK_LEVEL
+#define LOG_MODULE_CLOCK_LEVEL LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_MODULE_TIME_LEVEL
+#define LOG_MODULE_TIME_LEVEL LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_MODULE_COMMISSIONING_LEVEL
+#define LOG_MODULE_COMMISSIONING_LEVEL LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_MODULE_FACTORY_RESET_LEVEL
+#define LOG_MODULE_FACTORY_RESET_LEVEL LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_MODULE_BATTERY_LEVEL
+#define LOG_MODULE_BATTERY_LEVEL LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_MODULE_KEY_LEVEL
+#define LOG_MODULE_KEY_LEVEL LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_MODULE_MHZ19_LEVEL
+#define LOG_MODULE_MHZ19_LEVEL LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_MODULE_SENSEAIR_LEVEL
+#define LOG_MODULE_SENSEAIR_LEVEL LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_MODULE_TL_RESETTER_LEVEL
+#define LOG_MODULE_TL_RESETTER_LEVEL LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_MODULE_DEBUG_LEVEL
+#define LOG_MODULE_DEBUG_LEVEL LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_MODULE_LIGHT_LEVEL
+#define LOG_MODULE_LIGHT_LEVEL LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_MODULE_DIAGNOSTICS_LEVEL
+#define LOG_MODULE_DIAGNOSTICS_LEVEL LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_MODULE_CO2_LEVEL
+#define LOG_MODULE_CO2_LEVEL LOG_LEVEL_DEFAULT
+#endif
+
+#define LOG_THRESHOLD LOG_CAT(LOG_MODULE, _LEVEL)
+
 extern bool DebugInit(void);
-extern void LREP(char *format, ...);
-extern void LREPMaster(uint8 *data);
-#endif
\ No newline at end of file
+
+#ifdef DEBUG_TOKENIZED
+/*
+ * Tokenized log. The format string never reaches the firmware: a call site
+ * is identified by a 16-bit token of the module and the source line, the
+ * arguments are sent raw as 32-bit values. Record on the wire:
+ *   0xA5, token (LE), argc, argc * uint32 (LE)
+ * argc with DEBUG_ARGC_DUMP set is followed by that many raw bytes.
+ * Token 0 carries the number of records dropped on ring overflow.
+ * Token 1 carries Debug_TableId, log_decode.py refuses a capture whose id
+ * differs from the table it builds from the sources.
+ * Records go to the UART with DO_DEBUG_UART and to the sink if one is set.
+ */
+#define DEBUG_SYNC          0xA5
+#define DEBUG_ARGC_DUMP     0x80
+#define DEBUG_TOKEN_DROPPED 0x0000
+#define DEBUG_TOKEN_BUILD   0x0001
+
+#ifndef DEBUG_RING_SIZE
+#define DEBUG_RING_SIZE 256
+#endif
+
+#define LOG_TOKEN() ((uint16)(((uint16)(LOG_MODULE) << 11) | (__LINE__ & 0x07FF)))
+
+#define LOG_NARGS(...) LOG_NARGS_(__VA_ARGS__, 6, 5, 4, 3, 2, 1, 0)
+#define LOG_NARGS_(fmt, a1, a2, a3, a4, a5, a6, n, ...) n
+
+// the format is dropped here, every argument is widened to uint32
+#define LOG_ARGS_0(fmt)
+#define LOG_ARGS_1(fmt, a) , (uint32)(a)
+#define LOG_ARGS_2(fmt, a, b) , (uint32)(a), (uint32)(b)
+#define LOG_ARGS_3(fmt, a, b, c) , (uint32)(a), (uint32)(b), (uint32)(c)
+#define LOG_ARGS_4(fmt, a, b, c, d) , (uint32)(a), (uint32)(b), (uint32)(c), (uint32)(d)
+#define LOG_ARGS_5(fmt, a, b, c, d, e) , (uint32)(a), (uint32)(b), (uint32)(c), (uint32)(d), (uint32)(e)
+#define LOG_ARGS_6(fmt, a, b, c, d, e, f) , (uint32)(a), (uint32)(b), (uint32)(c), (uint32)(d), (uint32)(e), (uint32)(f)
+
+// Records above Debug_Level are skipped before their arguments are marshalled
+#define LOG_EMIT(level, ...)                                                                                               \
+    ((level) <= Debug_Level ? DebugLogToken(level, LOG_TOKEN(), LOG_NARGS(__VA_ARGS__)                                    \
+                                            LOG_CAT(LOG_ARGS_, LOG_NARGS(__VA_ARGS__))(__VA_ARGS__))                      \
+                            : (void)0)
+#define LOG_EMIT_DUMP(level, data, len) ((level) <= Debug_Level ? DebugLogDump(level, LOG_TOKEN(), (data), (len)) : (void)0)
+
+// Gets every record with its level, data is the argc * 4 argument bytes or the dump
+typedef void (*DebugSink_t)(uint8 level, uint16 token, uint8 argc, uint8 *data, uint8 len);
+
+extern void DebugLogToken(uint8 level, uint16 token, uint8 argc, ...);
+extern void DebugLogDump(uint8 level, uint16 token, uint8 *data, uint8 len);
+extern void DebugSetSink(DebugSink_t sink);
+// Runtime level of the records built at all, only changes without DO_DEBUG_UART
+extern uint8 Debug_Level;
+extern void DebugSetLevel(uint8 level);
+// Checksum of the token table, generated into version.c by ver.py
+extern const uint32 Debug_TableId;
+extern void DebugLogBuild(void);
+#ifdef DO_DEBUG_UART
+extern uint16 Debug_Dropped;
+#endif
+#else
+#define LOG_EMIT(level, ...) DebugPrintf(__VA_ARGS__)
+#define LOG_EMIT_DUMP(level, data, len) DebugDump((data), (len))
+
+void vprint(const char *fmt, va_list argp);
+extern void DebugPrintf(char *format, ...);
+extern void DebugPuts(uint8 *data);
+extern void DebugDump(uint8 *data, uint8 len);
+#endif
+
+#if LOG_THRESHOLD >= LOG_LEVEL_ERROR
+#define LOG_ERROR(...) LOG_EMIT(LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) ((void)0)
+#endif
+
+#if LOG_THRESHOLD >= LOG_LEVEL_WARN
+#define LOG_WARN(...) LOG_EMIT(LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define LOG_WARN(...) ((void)0)
+#endif
+
+#if LOG_THRESHOLD >= LOG_LEVEL_INFO
+#define LOG_INFO(...) LOG_EMIT(LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(...) ((void)0)
+#endif
+
+#if LOG_THRESHOLD >= LOG_LEVEL_TRACE
+#define LOG_TRACE(...) LOG_EMIT(LOG_LEVEL_TRACE, __VA_ARGS__)
+#define LOG_DUMP(data, len) LOG_EMIT_DUMP(LOG_LEVEL_TRACE, data, len)
+#else
+#define LOG_TRACE(...) ((void)0)
+#define LOG_DUMP(data, len) ((void)0)
+#endif
+
+// Older call sites log at the info level
+#define LREP(...) LOG_INFO(__VA_ARGS__)
+#define LREPMaster(data) LOG_INFO(data)
+#define LREPDump(data, len) LOG_DUMP(data, len)
+#endif
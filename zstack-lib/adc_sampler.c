@@ -0,0 +1,149 @@
+#include "adc_sampler.h"
+#include "OSAL.h"
+#include "hal_adc.h"
+#include "hal_dma.h"
+#include "hal_mcu.h"
+
+// ADCL in XDATA space, the DMA reads ADCL and ADCH as one word
+#define ADC_SAMPLER_ADCL 0x70BA
+
+// ADCCON1.STSEL
+#define ADC_STSEL_MASK  0x30
+#define ADC_STSEL_FULL  0x10 // sequences back to back
+#define ADC_STSEL_ST    0x30 // ADCCON1.ST only, stops the sequences
+
+// Polls the DMA every ADC_SAMPLER_POLL ms, a request that has not finished
+// after ADC_SAMPLER_TIMEOUT polls fails
+#define ADC_SAMPLER_POLL 1
+#define ADC_SAMPLER_TIMEOUT 20
+
+static uint8 adcSampler_TaskID = 0xFF;
+static adcSamplerRequest_t *adcSampler_Queued[ADC_SAMPLER_QUEUE_SIZE];
+static uint8 adcSampler_QueueHead = 0;
+static uint8 adcSampler_QueueCount = 0;
+
+static adcSamplerRequest_t *adcSampler_Current = NULL;
+static uint8 adcSampler_Polls;
+static uint16 adcSampler_Buffer[ADC_SAMPLER_BUFFER_SIZE];
+
+static uint8 adcSampler_ChannelsCount(uint8 channels);
+static void adcSampler_Start(adcSamplerRequest_t *request);
+static void adcSampler_Complete(uint8 status);
+
+static uint8 adcSampler_ChannelsCount(uint8 channels) {
+    uint8 count = 0;
+    while (channels) {
+        count += channels & 0x01;
+        channels >>= 1;
+    }
+    return count;
+}
+
+void adcSampler_Init(uint8 task_id) { adcSampler_TaskID = task_id; }
+
+bool adcSampler_Queue(adcSamplerRequest_t *request) {
+    uint8 count = adcSampler_ChannelsCount(request->Channels);
+
+    // the shift is only defined below 16 bits, bound it before
+    if (adcSampler_TaskID == 0xFF || count == 0 || request->Oversampling > ADC_SAMPLER_OVERSAMPLING_MAX ||
+        ((uint16)count << request->Oversampling) > ADC_SAMPLER_BUFFER_SIZE ||
+        request->Decimation > request->Oversampling || adcSampler_QueueCount == ADC_SAMPLER_QUEUE_SIZE) {
+        return FALSE;
+    }
+    adcSampler_Queued[(adcSampler_QueueHead + adcSampler_QueueCount) % ADC_SAMPLER_QUEUE_SIZE] = request;
+    adcSampler_QueueCount++;
+    if (adcSampler_Current == NULL) {
+        osal_set_event(adcSampler_TaskID, ADC_SAMPLER_EVT);
+    }
+    return TRUE;
+}
+
+uint16 adcSampler_event_loop(uint8 task_id, uint16 events) {
+    if (events & ADC_SAMPLER_EVT) {
+        if (adcSampler_Current != NULL) {
+            if (!HAL_DMA_CH_ARMED(ADC_SAMPLER_DMA_CH)) {
+                adcSampler_Complete(ADC_SAMPLER_SUCCESS);
+            } else if (++adcSampler_Polls >= ADC_SAMPLER_TIMEOUT) {
+                HAL_DMA_ABORT_CH(ADC_SAMPLER_DMA_CH);
+                adcSampler_Complete(ADC_SAMPLER_ERROR);
+            }
+        }
+        if (adcSampler_Current == NULL && adcSampler_QueueCount) {
+            adcSampler_Current = adcSampler_Queued[adcSampler_QueueHead];
+            adcSampler_QueueHead = (adcSampler_QueueHead + 1) % ADC_SAMPLER_QUEUE_SIZE;
+            adcSampler_QueueCount--;
+            adcSampler_Start(adcSampler_Current);
+        }
+        if (adcSampler_Current != NULL) {
+            osal_start_timerEx(adcSampler_TaskID, ADC_SAMPLER_EVT, ADC_SAMPLER_POLL);
+        }
+        return (events ^ ADC_SAMPLER_EVT);
+    }
+    return 0;
+}
+
+static void adcSampler_Start(adcSamplerRequest_t *request) {
+    halDMADesc_t *ch = HAL_DMA_GET_DESC1234(ADC_SAMPLER_DMA_CH);
+    uint16 len = (uint16)adcSampler_ChannelsCount(request->Channels) << request->Oversampling;
+    uint8 last = ADC_SAMPLER_CHANNELS - 1;
+
+    while (!(request->Channels & BV(last))) {
+        last--;
+    }
+
+    HAL_DMA_SET_SOURCE(ch, ADC_SAMPLER_ADCL);
+    HAL_DMA_SET_DEST(ch, adcSampler_Buffer);
+    HAL_DMA_SET_VLEN(ch, HAL_DMA_VLEN_USE_LEN);
+    HAL_DMA_SET_LEN(ch, len);
+    HAL_DMA_SET_WORD_SIZE(ch, HAL_DMA_WORDSIZE_WORD);
+    HAL_DMA_SET_TRIG_MODE(ch, HAL_DMA_TMODE_SINGLE);
+    HAL_DMA_SET_TRIG_SRC(ch, HAL_DMA_TRIG_ADC_CHALL);
+    HAL_DMA_SET_SRC_INC(ch, HAL_DMA_SRCINC_0);
+    HAL_DMA_SET_DST_INC(ch, HAL_DMA_DSTINC_1);
+    HAL_DMA_SET_IRQ(ch, HAL_DMA_IRQMASK_DISABLE);
+    HAL_DMA_SET_M8(ch, HAL_DMA_M8_USE_8_BITS);
+    HAL_DMA_SET_PRIORITY(ch, HAL_DMA_PRI_HIGH);
+    HAL_DMA_CLEAR_IRQ(ADC_SAMPLER_DMA_CH);
+    HAL_DMA_ARM_CH(ADC_SAMPLER_DMA_CH);
+
+    // a sequence converts AIN0..last, skipping the pins not in APCFG
+    APCFG |= request->Channels;
+    ADCCON2 = request->Reference | ((request->Resolution - HAL_ADC_RESOLUTION_8) << 4) | last;
+    adcSampler_Polls = 0;
+    ADCCON1 = (ADCCON1 & ~ADC_STSEL_MASK) | ADC_STSEL_FULL;
+}
+
+static void adcSampler_Complete(uint8 status) {
+    adcSamplerRequest_t *request = adcSampler_Current;
+    uint8 count = adcSampler_ChannelsCount(request->Channels);
+    // samples are left aligned, the sign bit on top
+    uint8 shift = 16 - (6 + 2 * request->Resolution);
+
+    ADCCON1 |= ADC_STSEL_ST;
+    APCFG &= ~request->Channels;
+    adcSampler_Current = NULL;
+
+    for (uint8 channel = 0, index = 0; channel < ADC_SAMPLER_CHANNELS; channel++) {
+        uint32 sum = 0;
+
+        if (!(request->Channels & BV(channel))) {
+            request->Results[channel] = 0;
+            continue;
+        }
+        if (status == ADC_SAMPLER_SUCCESS) {
+            for (uint16 i = index; i < ((uint16)count << request->Oversampling); i += count) {
+                // slightly negative near ground
+                if (!(adcSampler_Buffer[i] & 0x8000)) {
+                    sum += adcSampler_Buffer[i] >> shift;
+                }
+            }
+        }
+        request->Results[channel] = (uint16)(sum >> (request->Oversampling - request->Decimation));
+        index++;
+    }
+
+    request->Status = status;
+    if (request->Callback != NULL) {
+        request->Callback(request);
+    }
+}
@@ -0,0 +1,65 @@
+#ifndef ADC_SAMPLER_H
+#define ADC_SAMPLER_H
+
+#define ADC_SAMPLER_EVT 0x0001
+
+#define ADC_SAMPLER_SUCCESS 0
+#define ADC_SAMPLER_ERROR   1
+
+// Background sampling of the AIN0..AIN7 pins. A request converts its
+// channels as one ADC sequence, 2^Oversampling times back to back, and DMA
+// moves the samples to a buffer, so the CPU is free meanwhile. The task
+// sums them per channel and calls the callback.
+//
+// Internal channels (VDD/3, temperature) cannot be part of a sequence and
+// HalAdcRead must not run while a request is in progress.
+#ifndef ADC_SAMPLER_DMA_CH
+#define ADC_SAMPLER_DMA_CH 1
+#endif
+
+// samples of all channels of one request
+#ifndef ADC_SAMPLER_BUFFER_SIZE
+#define ADC_SAMPLER_BUFFER_SIZE 64
+#endif
+
+// log2(ADC_SAMPLER_BUFFER_SIZE), the largest Oversampling of one channel
+#if ADC_SAMPLER_BUFFER_SIZE >= 128
+#define ADC_SAMPLER_OVERSAMPLING_MAX 7
+#elif ADC_SAMPLER_BUFFER_SIZE >= 64
+#define ADC_SAMPLER_OVERSAMPLING_MAX 6
+#elif ADC_SAMPLER_BUFFER_SIZE >= 32
+#define ADC_SAMPLER_OVERSAMPLING_MAX 5
+#elif ADC_SAMPLER_BUFFER_SIZE >= 16
+#define ADC_SAMPLER_OVERSAMPLING_MAX 4
+#elif ADC_SAMPLER_BUFFER_SIZE >= 8
+#define ADC_SAMPLER_OVERSAMPLING_MAX 3
+#elif ADC_SAMPLER_BUFFER_SIZE >= 4
+#define ADC_SAMPLER_OVERSAMPLING_MAX 2
+#else
+#error "ADC_SAMPLER_BUFFER_SIZE is too small"
+#endif
+
+#ifndef ADC_SAMPLER_QUEUE_SIZE
+#define ADC_SAMPLER_QUEUE_SIZE 4
+#endif
+
+#define ADC_SAMPLER_CHANNELS 8
+
+typedef struct adcSamplerRequest {
+    uint8 Channels;     // AINx bit mask
+    uint8 Resolution;   // HAL_ADC_RESOLUTION_*
+    uint8 Reference;    // HAL_ADC_REF_*
+    uint8 Oversampling; // 2^Oversampling samples per channel
+    uint8 Decimation;   // extra bits kept from the sum, up to Oversampling, 0 - plain average
+    uint8 Status;       // ADC_SAMPLER_SUCCESS or ADC_SAMPLER_ERROR in the callback
+    uint16 Results[ADC_SAMPLER_CHANNELS]; // by AIN number
+    void (*Callback)(struct adcSamplerRequest *request);
+} adcSamplerRequest_t;
+
+extern void adcSampler_Init(uint8 task_id);
+extern uint16 adcSampler_event_loop(uint8 task_id, uint16 events);
+// The request must stay valid until its callback. FALSE when the queue is
+// full, Oversampling is above ADC_SAMPLER_OVERSAMPLING_MAX or the samples do
+// not fit ADC_SAMPLER_BUFFER_SIZE
+extern bool adcSampler_Queue(adcSamplerRequest_t *request);
+#endif
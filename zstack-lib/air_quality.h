@@ -1,9 +1,28 @@
 #ifndef AIR_QUALITY_H
 #define AIR_QUALITY_H
 
+#include "hal_uart.h"
+
 #define AIR_QUALITY_INVALID_RESPONSE 0xFFFF
 
-typedef void (*request_measure_t)(void);
+// The CO2 drivers talk through the UART manager, the port is theirs alone
+#ifndef CO2_UART_PORT
+#define CO2_UART_PORT HAL_UART_PORT_1
+#endif
+
+#ifndef CO2_UART_TIMEOUT
+#define CO2_UART_TIMEOUT 100 // ms
+#endif
+#ifndef CO2_UART_RETRIES
+#define CO2_UART_RETRIES 2
+#endif
+
+// called once the requested measurement is done, with the ppm or
+// AIR_QUALITY_INVALID_RESPONSE. A request while one is in progress is
+// dropped, the callback comes for the earlier one
+typedef void (*air_quality_cb_t)(uint16 ppm);
+typedef void (*request_measure_t)(air_quality_cb_t callback);
+// last measured value, AIR_QUALITY_INVALID_RESPONSE when the last request failed
 typedef uint16 (*read_t)(void);
 typedef void (*set_ABC_t)(bool isEnabled);
 
@@ -13,4 +32,4 @@ typedef struct {
   set_ABC_t SetABC;
 } zclAirSensor_t;
 
-#endif //AIR_QUALITY_H
\ No newline at end of file
+#endif //AIR_QUALITY_H
@@ -0,0 +1,31 @@
+#include "OSAL.h"
+#include "backoff.h"
+
+void backoffReset(backoff_t *backoff) {
+    backoff->Delay = backoff->Config->Min;
+    backoff->Attempts = 0;
+}
+
+uint32 backoffNext(backoff_t *backoff) {
+    CONST backoffConfig_t *config = backoff->Config;
+    uint32 delay = backoff->Delay;
+    // osal_rand() comes from the radio RNG
+    uint32 random = ((uint32)osal_rand() << 16) | osal_rand();
+    uint32 part = (delay >> 8) * config->Jitter + (((delay & 0xFF) * config->Jitter) >> 8);
+
+    if (config->Tries && backoff->Attempts >= config->Tries) {
+        backoff->Delay = config->Max;
+    } else {
+        backoff->Attempts++;
+        // delay * Growth / 256 without overflowing 32 bits
+        backoff->Delay = (delay >> 8) * config->Growth + (((delay & 0xFF) * config->Growth) >> 8);
+        if (backoff->Delay > config->Max || backoff->Delay < delay) {
+            backoff->Delay = config->Max;
+        }
+    }
+
+    if (part) {
+        delay = delay - part + random % (part + 1);
+    }
+    return delay;
+}
@@ -0,0 +1,28 @@
+#ifndef BACKOFF_H
+#define BACKOFF_H
+
+// Retry delays that grow by a fixed-point factor up to a cap, with a random
+// part from the radio RNG so devices that failed together do not retry in
+// step. The policy lives in a const config, the state in backoff_t.
+typedef struct {
+    uint32 Min;    // first delay, ms
+    uint32 Max;    // cap, ms
+    uint16 Growth; // factor per attempt in 1/256: 512 - x2, 307 - x1.2
+    uint8 Jitter;  // random part of the delay in 1/256, taken off the delay
+    uint8 Tries;   // attempts that grow the delay, then straight to Max, 0 - no limit
+} backoffConfig_t;
+
+#define BACKOFF_GROWTH(factor) ((uint16)((factor) * 256.0 + 0.5))
+#define BACKOFF_JITTER(part) ((uint8)((part) * 256.0 + 0.5))
+
+typedef struct {
+    CONST backoffConfig_t *Config;
+    uint32 Delay;
+    uint8 Attempts;
+} backoff_t;
+
+// Back to Min, after a success
+extern void backoffReset(backoff_t *backoff);
+// Delay before the next attempt, grows the following one
+extern uint32 backoffNext(backoff_t *backoff);
+#endif
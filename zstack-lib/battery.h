@@ -3,6 +3,21 @@
 //This is custom attribute
 #define ATTRID_POWER_CFG_BATTERY_VOLTAGE_RAW_ADC                0x0200
 
+// (( 3 * 1.15 ) / (( 2^14 / 2 ) - 1 )) * 1000 (not correct)
+// #define MULTI (float) 0.4211939934
+// this coefficient calculated using
+// https://docs.google.com/spreadsheets/d/1qrFdMTo0ZrqtlGUoafeB3hplhU3GzDnVWuUK4M9OgNo/edit?usp=sharing
+#define MULTI 0.443
+// millivolts per raw unit in Q16, folded by the compiler
+#define MULTI_Q16 ((uint32)(MULTI * 65536.0 + 0.5))
+#define BATTERY_RAW_TO_MILLIVOLTS(raw) ((uint16)(((uint32)(raw) * MULTI_Q16 + 0x8000) >> 16))
+
+// CR2032 discharge curve, remaining percentage * 2 (ZCL units) by millivolts.
+// Shared with tools/fixed_point_test.c
+#define CR2032_POINT(millivolts, percentage) {(millivolts), (uint16)((percentage) * 2)}
+#define BATTERY_CURVE_CR2032                                                                                           \
+    {CR2032_POINT(2100, 0), CR2032_POINT(2440, 6), CR2032_POINT(2740, 18), CR2032_POINT(2900, 42), CR2032_POINT(3000, 100)}
+
 
 extern uint8 zclBattery_Voltage;
 extern uint8 zclBattery_PercentageRemainig;
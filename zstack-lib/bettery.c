@@ -1,3 +1,4 @@
+#define LOG_MODULE LOG_MODULE_BATTERY
 #include "Debug.h"
 #include "battery.h"
 #include "hal_adc.h"
@@ -6,14 +7,10 @@
 #include "zcl.h"
 #include "zcl_general.h"
 #include "bdb_interface.h"
-// (( 3 * 1.15 ) / (( 2^14 / 2 ) - 1 )) * 1000 (not correct)
-// #define MULTI (float) 0.4211939934
-// this coefficient calculated using
-// https://docs.google.com/spreadsheets/d/1qrFdMTo0ZrqtlGUoafeB3hplhU3GzDnVWuUK4M9OgNo/edit?usp=sharing
-#define MULTI (float)0.443
+#define VOLTAGE_MIN 2000 // mV
+#define VOLTAGE_MAX 3300
 
-#define VOLTAGE_MIN 2.0
-#define VOLTAGE_MAX 3.3
+static CONST curvePoint_t batteryCurveCR2032[] = BATTERY_CURVE_CR2032;
 
 #ifndef ZCL_BATTERY_REPORT_INTERVAL
     #define ZCL_BATTERY_REPORT_INTERVAL ((uint32) 1800000) //30 minutes
@@ -48,27 +45,13 @@ uint8 getBatteryVoltageZCL(uint16 millivolts) {
 uint16 getBatteryVoltage(void) {
     HalAdcSetReference(HAL_ADC_REF_125V);
     zclBattery_RawAdc = adcReadSampled(HAL_ADC_CHANNEL_VDD, HAL_ADC_RESOLUTION_14, HAL_ADC_REF_125V, 10);
-    return (uint16)(zclBattery_RawAdc * MULTI);
+    return BATTERY_RAW_TO_MILLIVOLTS(zclBattery_RawAdc);
 }
 
-uint8 getBatteryRemainingPercentageZCL(uint16 millivolts) { return (uint8)mapRange(VOLTAGE_MIN, VOLTAGE_MAX, 0.0, 200.0, millivolts); }
+uint8 getBatteryRemainingPercentageZCL(uint16 millivolts) { return (uint8)mapRange(VOLTAGE_MIN, VOLTAGE_MAX, 0, 200, millivolts); }
 
 uint8 getBatteryRemainingPercentageZCLCR2032(uint16 volt16) {
-    float battery_level;
-    if (volt16 >= 3000) {
-        battery_level = 100;
-    } else if (volt16 > 2900) {
-        battery_level = 100 - ((3000 - volt16) * 58) / 100;
-    } else if (volt16 > 2740) {
-        battery_level = 42 - ((2900 - volt16) * 24) / 160;
-    } else if (volt16 > 2440) {
-        battery_level = 18 - ((2740 - volt16) * 12) / 300;
-    } else if (volt16 > 2100) {
-        battery_level = 6 - ((2440 - volt16) * 6) / 340;
-    } else {
-        battery_level = 0;
-    }
-    return (uint8)(battery_level * 2);
+    return (uint8)curveInterpolate(batteryCurveCR2032, sizeof(batteryCurveCR2032) / sizeof(batteryCurveCR2032[0]), volt16);
 }
 
 void zclBattery_Report(void) {
@@ -1,4 +1,5 @@
 #include "commissioning.h"
+#define LOG_MODULE LOG_MODULE_COMMISSIONING
 #include "Debug.h"
 #include "OSAL_PwrMgr.h"
 #include "ZDApp.h"
@@ -8,11 +9,19 @@
 
 static void zclCommissioning_ProcessCommissioningStatus(bdbCommissioningModeMsg_t *bdbCommissioningModeMsg);
 static void zclCommissioning_ResetBackoffRetry(void);
+static void zclCommissioning_ScheduleRejoin(void);
 static void zclCommissioning_BindNotification(bdbBindNotificationData_t *data);
 extern bool requestNewTrustCenterLinkKey;
 
-byte rejoinsLeft = APP_COMMISSIONING_END_DEVICE_REJOIN_TRIES;
-uint32 rejoinDelay = APP_COMMISSIONING_END_DEVICE_REJOIN_START_DELAY;
+static CONST backoffConfig_t zclCommissioning_RejoinPolicy = {
+    .Min = APP_COMMISSIONING_END_DEVICE_REJOIN_START_DELAY,
+    .Max = APP_COMMISSIONING_END_DEVICE_REJOIN_MAX_DELAY,
+    .Growth = APP_COMMISSIONING_END_DEVICE_REJOIN_BACKOFF,
+    .Jitter = APP_COMMISSIONING_END_DEVICE_REJOIN_JITTER,
+    .Tries = APP_COMMISSIONING_END_DEVICE_REJOIN_TRIES,
+};
+static backoff_t zclCommissioning_Rejoin = {.Config = &zclCommissioning_RejoinPolicy,
+                                            .Delay = APP_COMMISSIONING_END_DEVICE_REJOIN_START_DELAY};
 
 uint8 zclCommissioning_TaskId = 0;
 
@@ -34,15 +43,22 @@ void zclCommissioning_Init(uint8 task_id) {
     bdb_StartCommissioning(BDB_COMMISSIONING_MODE_NWK_STEERING | BDB_COMMISSIONING_MODE_FINDING_BINDING);
 }
 
-static void zclCommissioning_ResetBackoffRetry(void) {
-    rejoinsLeft = APP_COMMISSIONING_END_DEVICE_REJOIN_TRIES;
-    rejoinDelay = APP_COMMISSIONING_END_DEVICE_REJOIN_START_DELAY;
-}
+static void zclCommissioning_ResetBackoffRetry(void) { backoffReset(&zclCommissioning_Rejoin); }
 
 static void zclCommissioning_OnConnect(void) {
     LREPMaster("zclCommissioning_OnConnect \r\n");
     zclCommissioning_ResetBackoffRetry();
+#if ZG_BUILD_ENDDEVICE_TYPE
     osal_start_timerEx(zclCommissioning_TaskId, APP_COMMISSIONING_CLOCK_DOWN_POLING_RATE_EVT, 10 * 1000);
+#endif
+}
+
+// Next retry after the backoff delay, the delay grows while tries are left
+static void zclCommissioning_ScheduleRejoin(void) {
+    uint32 delay = backoffNext(&zclCommissioning_Rejoin);
+
+    LREP("rejoin attempt %d delay=%ld\r\n", zclCommissioning_Rejoin.Attempts, delay);
+    osal_start_timerEx(zclCommissioning_TaskId, APP_COMMISSIONING_END_DEVICE_REJOIN_EVT, delay);
 }
 
 static void zclCommissioning_ProcessCommissioningStatus(bdbCommissioningModeMsg_t *bdbCommissioningModeMsg) {
@@ -73,6 +89,12 @@ static void zclCommissioning_ProcessCommissioningStatus(bdbCommissioningModeMsg_
 
         default:
             HalLedSet(HAL_LED_1, HAL_LED_MODE_BLINK);
+#if ZG_BUILD_RTR_TYPE
+            // mains powered, keep looking for the network instead of waiting for a button press
+            if (!bdbAttributes.bdbNodeIsOnANetwork) {
+                zclCommissioning_ScheduleRejoin();
+            }
+#endif
             break;
         }
 
@@ -88,14 +110,7 @@ static void zclCommissioning_ProcessCommissioningStatus(bdbCommissioningModeMsg_
         default:
             HalLedSet(HAL_LED_1, HAL_LED_MODE_BLINK);
             // // Parent not found, attempt to rejoin again after a exponential backoff delay
-            LREP("rejoinsLeft %d rejoinDelay=%ld\r\n", rejoinsLeft, rejoinDelay);
-            if (rejoinsLeft > 0) {
-                rejoinDelay *= APP_COMMISSIONING_END_DEVICE_REJOIN_BACKOFF;
-                rejoinsLeft -= 1;
-            } else {
-                rejoinDelay = APP_COMMISSIONING_END_DEVICE_REJOIN_MAX_DELAY;
-            }
-            osal_start_timerEx(zclCommissioning_TaskId, APP_COMMISSIONING_END_DEVICE_REJOIN_EVT, rejoinDelay);
+            zclCommissioning_ScheduleRejoin();
             break;
         }
         break;
@@ -132,7 +147,7 @@ uint16 zclCommissioning_event_loop(uint8 task_id, uint16 events) {
                 HalLedSet(HAL_LED_1, HAL_LED_MODE_BLINK);
                 zclApp_NwkState = (devStates_t)(MSGpkt->hdr.status);
                 LREP("NwkState=%d\r\n", zclApp_NwkState);
-                if (zclApp_NwkState == DEV_END_DEVICE) {
+                if (zclApp_NwkState == DEV_END_DEVICE || zclApp_NwkState == DEV_ROUTER) {
                     HalLedSet(HAL_LED_1, HAL_LED_MODE_OFF);
                 }
                 break;
@@ -155,7 +170,14 @@ uint16 zclCommissioning_event_loop(uint8 task_id, uint16 events) {
     if (events & APP_COMMISSIONING_END_DEVICE_REJOIN_EVT) {
         LREPMaster("APP_END_DEVICE_REJOIN_EVT\r\n");
 #if ZG_BUILD_ENDDEVICE_TYPE
-        bdb_ZedAttemptRecoverNwk();
+        if (ZG_DEVICE_ENDDEVICE_TYPE) {
+            bdb_ZedAttemptRecoverNwk();
+        }
+#endif
+#if ZG_BUILD_RTR_TYPE
+        if (ZG_DEVICE_RTR_TYPE && !bdbAttributes.bdbNodeIsOnANetwork) {
+            bdb_StartCommissioning(BDB_COMMISSIONING_MODE_NWK_STEERING | BDB_COMMISSIONING_MODE_FINDING_BINDING);
+        }
 #endif
         return (events ^ APP_COMMISSIONING_END_DEVICE_REJOIN_EVT);
     }
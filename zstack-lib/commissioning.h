@@ -1,13 +1,19 @@
 #ifndef commissioning_h
 #define commissioning_h
 
+#include "backoff.h"
+
 #define APP_COMMISSIONING_CLOCK_DOWN_POLING_RATE_EVT  0x0001
 #define APP_COMMISSIONING_END_DEVICE_REJOIN_EVT       0x0002
 
 #define APP_COMMISSIONING_END_DEVICE_REJOIN_MAX_DELAY ((uint32)1800000) // 30 minutes 30 * 60 * 1000
-#define APP_COMMISSIONING_END_DEVICE_REJOIN_START_DELAY 10 * 1000 // 10 seconds
-#define APP_COMMISSIONING_END_DEVICE_REJOIN_BACKOFF ((float) 1.2)
+#define APP_COMMISSIONING_END_DEVICE_REJOIN_START_DELAY ((uint32)10 * 1000) // 10 seconds
+#define APP_COMMISSIONING_END_DEVICE_REJOIN_BACKOFF BACKOFF_GROWTH(1.2)
 #define APP_COMMISSIONING_END_DEVICE_REJOIN_TRIES 20
+// random part of the delay, parents lost by many devices at once are not hit together
+#ifndef APP_COMMISSIONING_END_DEVICE_REJOIN_JITTER
+#define APP_COMMISSIONING_END_DEVICE_REJOIN_JITTER BACKOFF_JITTER(0.25)
+#endif
 
 
 
@@ -1,4 +1,5 @@
 #include "ds18b20.h"
+#include "OSAL.h"
 #include "OnBoard.h"
 
 #define DS18B20_SKIP_ROM 0xCC
@@ -16,16 +17,15 @@
 #define DS18B20_RESOLUTION DS18B20_TEMP_10_BIT
 #endif
 
-#ifndef DS18B20_RETRY_COUNT
-#define DS18B20_RETRY_COUNT 10
-#endif
+// 93.75 ms at 9 bit, doubled for each extra bit
+#define DS18B20_CONVERSION_TIME ((uint16)94 << (DS18B20_RESOLUTION >> 5))
 
-#define MAX_CONVERSION_TIME (750 * 1.2) // ms 750ms + some overhead
+#define DS18B20_SCRATCHPAD_SIZE 9
 
-#define DS18B20_RETRY_DELAY ((uint16) (MAX_CONVERSION_TIME / DS18B20_RETRY_COUNT))
+static uint8 ds18b20_TaskID;
+static ds18b20Callback_t ds18b20_Callback = NULL;
 
 static void _delay_us(uint16);
-static void _delay_ms(uint16);
 static void ds18b20_send(uint8);
 static uint8 ds18b20_read(void);
 static void ds18b20_send_byte(int8);
@@ -34,17 +34,13 @@ static uint8 ds18b20_Reset(void);
 static void ds18b20_GroudPins(void);
 static void ds18b20_setResolution(uint8 resolution);
 static int16 ds18b20_convertTemperature(uint8 temp1, uint8 temp2, uint8 resolution);
+static uint8 ds18b20_crc8(const uint8 *data, uint8 len);
+static int16 ds18b20_readScratchpad(void);
 
 static void _delay_us(uint16 microSecs) {
     MicroWait(microSecs);
 }
 
-static void _delay_ms(uint16 milliSecs) {
-    while (milliSecs--) {
-        _delay_us(1000);
-    }
-}
-
 // Sends one bit to bus
 static void ds18b20_send(uint8 bit) {
     TSENS_SBIT = 1;
@@ -130,74 +126,77 @@ static void ds18b20_setResolution(uint8 resolution) {
     ds18b20_send_byte(resolution);
     ds18b20_Reset();
 }
+
 static int16 ds18b20_convertTemperature(uint8 temp1, uint8 temp2, uint8 resolution) {
-    float temperature = 0;
-    uint8 ignoreMask = 0;
-    switch (resolution) {
-    case DS18B20_TEMP_9_BIT:
-        ignoreMask = (BV(0) | BV(1) | BV(2));
-        break;
-
-    case DS18B20_TEMP_10_BIT:
-        ignoreMask = (BV(0) | BV(1));
-        break;
-
-    case DS18B20_TEMP_11_BIT:
-        ignoreMask = (BV(0));
-        break;
-
-    case DS18B20_TEMP_12_BIT:
-        ignoreMask = 0;
-        break;
-
-    default:
-        break;
+    // bits below the resolution are undefined
+    uint8 ignoreMask = 0x07 >> ((resolution >> 5) & 0x03);
+    int16 raw = (int16)(((uint16)temp2 << 8) | (temp1 & ~ignoreMask));
+
+    // 1/16 degree to 1/100
+    return (int16)(((int32)raw * 25) / 4);
+}
+
+// Dallas/Maxim CRC-8 (poly x^8 + x^5 + x^4 + 1, reflected)
+static uint8 ds18b20_crc8(const uint8 *data, uint8 len) {
+    uint8 crc = 0;
+    while (len--) {
+        crc ^= *data++;
+        for (uint8 i = 0; i < 8; i++) {
+            crc = (crc & 0x01) ? (crc >> 1) ^ 0x8C : (crc >> 1);
+        }
     }
-    temperature = (uint16)temp1 | (uint16)(ignoreMask ? temp2 & ignoreMask : temp2) << 8;
-    // neg. temp
-    if (temp2 & (BV(3))) {
-        temperature = temperature / 16.0 - 128.0;
+    return crc;
+}
+
+static int16 ds18b20_readScratchpad(void) {
+    uint8 scratchpad[DS18B20_SCRATCHPAD_SIZE];
+
+    ds18b20_Reset();
+    ds18b20_send_byte(DS18B20_SKIP_ROM);
+    ds18b20_send_byte(DS18B20_READ_SCRATCHPAD);
+    for (uint8 i = 0; i < DS18B20_SCRATCHPAD_SIZE; i++) {
+        scratchpad[i] = ds18b20_read_byte();
     }
-    // pos. temp
-    else {
-        temperature = temperature / 16.0;
+    ds18b20_GroudPins();
+
+    // No sensor reads as all ones, a shorted bus as all zeros with a valid CRC,
+    // the low bits of the config register are always set
+    if ((scratchpad[4] & 0x1F) != 0x1F || ds18b20_crc8(scratchpad, DS18B20_SCRATCHPAD_SIZE - 1) != scratchpad[8]) {
+        return DS18B20_TEMPERATURE_INVALID;
     }
-    return (int16)(temperature * 100);
+    return ds18b20_convertTemperature(scratchpad[0], scratchpad[1], DS18B20_RESOLUTION);
 }
 
-int16 readTemperature(void) {
-
-    uint8 temp1, temp2, retry_count = DS18B20_RETRY_COUNT;
+void ds18b20_Init(uint8 task_id) {
+    ds18b20_TaskID = task_id;
+    // the sensor keeps it until power off
     ds18b20_setResolution(DS18B20_RESOLUTION);
-    ds18b20_Reset();
+    ds18b20_GroudPins();
+}
 
-    ds18b20_send_byte(DS18B20_SKIP_ROM);
-    ds18b20_send_byte(DS18B20_CONVERT_T);
+uint16 ds18b20_event_loop(uint8 task_id, uint16 events) {
+    if (events & DS18B20_READ_EVT) {
+        ds18b20Callback_t callback = ds18b20_Callback;
 
-    while (retry_count) {
-        _delay_ms(DS18B20_RETRY_DELAY);
-        ds18b20_Reset();
-        ds18b20_send_byte(DS18B20_SKIP_ROM);
-        ds18b20_send_byte(DS18B20_READ_SCRATCHPAD);
-        temp1 = ds18b20_read_byte();
-        temp2 = ds18b20_read_byte();
-        ds18b20_Reset();
-
-        if (temp1 == 0xff && temp2 == 0xff) {
-            // No sensor found.
-            ds18b20_GroudPins();
-            return 1;
+        ds18b20_Callback = NULL;
+        if (callback != NULL) {
+            callback(ds18b20_readScratchpad());
         }
-        if (temp1 == 0x50 && temp2 == 0x05) {
-            // Power-up State, not ready yet
-            retry_count--;
-            continue;
-        }
-
-        ds18b20_GroudPins();
-        return ds18b20_convertTemperature(temp1, temp2, DS18B20_RESOLUTION);
+        return (events ^ DS18B20_READ_EVT);
     }
+    return 0;
+}
 
+bool ds18b20_StartConversion(ds18b20Callback_t callback) {
+    if (ds18b20_Callback != NULL) {
+        return FALSE;
+    }
+    ds18b20_Reset();
+    ds18b20_send_byte(DS18B20_SKIP_ROM);
+    ds18b20_send_byte(DS18B20_CONVERT_T);
     ds18b20_GroudPins();
-    return 1;
-}
\ No newline at end of file
+
+    ds18b20_Callback = callback;
+    osal_start_timerEx(ds18b20_TaskID, DS18B20_READ_EVT, DS18B20_CONVERSION_TIME);
+    return TRUE;
+}
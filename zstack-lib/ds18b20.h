@@ -1,4 +1,17 @@
 #ifndef ds18b20_h
-int16 readTemperature(void);
 #define ds18b20_h
+
+#define DS18B20_READ_EVT 0x0001
+
+// ZCL invalid temperature
+#define DS18B20_TEMPERATURE_INVALID ((int16)0x8000)
+
+// temperature in 1/100 degree or DS18B20_TEMPERATURE_INVALID
+typedef void (*ds18b20Callback_t)(int16 temperature);
+
+extern void ds18b20_Init(uint8 task_id);
+extern uint16 ds18b20_event_loop(uint8 task_id, uint16 events);
+// Starts a conversion and returns, the scratchpad is read by the task when
+// the conversion time of DS18B20_RESOLUTION has passed. FALSE while busy
+extern bool ds18b20_StartConversion(ds18b20Callback_t callback);
 #endif
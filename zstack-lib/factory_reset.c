@@ -1,5 +1,6 @@
 #include "factory_reset.h"
 #include "AF.h"
+#define LOG_MODULE LOG_MODULE_FACTORY_RESET
 #include "Debug.h"
 #include "OnBoard.h"
 #include "bdb.h"
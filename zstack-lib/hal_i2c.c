@@ -40,6 +40,7 @@
 #include "hal_i2c.h"
 
 #include "Debug.h"
+#include "OSAL.h"
 #include "ioCC2530.h"
 #include "zcomdef.h"
 #include "utils.h"
@@ -50,6 +51,15 @@
 #define HAL_I2C_RETRY_CNT 3
 #endif
 
+// Queued transactions: data bytes clocked per event before yielding to OSAL
+#ifndef HAL_I2C_CHUNK_SIZE
+#define HAL_I2C_CHUNK_SIZE 8
+#endif
+
+#ifndef HAL_I2C_QUEUE_SIZE
+#define HAL_I2C_QUEUE_SIZE 4
+#endif
+
 // the default cofiguration below uses P0.6 for SDA and P0.5 for SCL.
 // change these as needed.
 #ifndef OCM_CLK_PORT
@@ -567,4 +577,152 @@ int8 I2C_WriteMultByte(uint8 address, uint8 reg, uint8 *buffer, uint16 len) {
 
     hali2cStop();
     return I2C_SUCCESS;
-}
\ No newline at end of file
+}
+
+/*********************************************************************
+ * Queued transactions
+ *
+ * One transaction is in progress at a time. Every HAL_I2C_PROCESS_EVT
+ * clocks the address phase or up to HAL_I2C_CHUNK_SIZE data bytes and
+ * sets the event again, so the radio and the other tasks run between
+ * the chunks. The ACK clock leaves SCL released high, so each phase
+ * ends by driving SCL low: slaves see a slow master, and SDA may change
+ * meanwhile without being taken for a START or STOP. A NACK in the
+ * address phase restarts the transaction, up to HAL_I2C_RETRY_CNT times.
+ */
+static uint8 hali2cTaskID = 0xFF;
+static halI2CTransaction_t *hali2cQueue[HAL_I2C_QUEUE_SIZE];
+static uint8 hali2cQueueHead = 0;
+static uint8 hali2cQueueCount = 0;
+
+static halI2CTransaction_t *hali2cCurrent = NULL;
+static uint16 hali2cPos;
+static uint8 hali2cRetry;
+static bool hali2cAddressed;
+
+static bool hali2cAddress(halI2CTransaction_t *t);
+static bool hali2cTransferChunk(halI2CTransaction_t *t);
+static void hali2cComplete(uint8 status);
+
+/*********************************************************************
+ * @fn      HalI2CTaskInit
+ * @brief   Initializes the task that runs queued transactions
+ * @param   task_id - OSAL task id
+ * @return  void
+ */
+void HalI2CTaskInit(uint8 task_id) {
+    hali2cTaskID = task_id;
+    HalI2CInit();
+}
+
+/*********************************************************************
+ * @fn      HalI2CQueue
+ * @brief   Queues a transaction. The transaction and its buffer must
+ *          stay valid until the callback is called from the I2C task.
+ * @param   t - transaction
+ * @return  I2C_SUCCESS when queued, I2C_ERROR when the queue is full
+ *          or the task is not running
+ */
+int8 HalI2CQueue(halI2CTransaction_t *t) {
+    halIntState_t intState;
+
+    if (hali2cTaskID == 0xFF || !t->Len) {
+        return I2C_ERROR;
+    }
+    HAL_ENTER_CRITICAL_SECTION(intState);
+    if (hali2cQueueCount == HAL_I2C_QUEUE_SIZE) {
+        HAL_EXIT_CRITICAL_SECTION(intState);
+        return I2C_ERROR;
+    }
+    hali2cQueue[(hali2cQueueHead + hali2cQueueCount) % HAL_I2C_QUEUE_SIZE] = t;
+    hali2cQueueCount++;
+    HAL_EXIT_CRITICAL_SECTION(intState);
+
+    osal_set_event(hali2cTaskID, HAL_I2C_PROCESS_EVT);
+    return I2C_SUCCESS;
+}
+
+uint16 HalI2CProcessEvent(uint8 task_id, uint16 events) {
+    if (events & HAL_I2C_PROCESS_EVT) {
+        if (hali2cCurrent == NULL && hali2cQueueCount) {
+            hali2cCurrent = hali2cQueue[hali2cQueueHead];
+            hali2cQueueHead = (hali2cQueueHead + 1) % HAL_I2C_QUEUE_SIZE;
+            hali2cQueueCount--;
+            hali2cPos = 0;
+            hali2cRetry = HAL_I2C_RETRY_CNT;
+            hali2cAddressed = FALSE;
+        }
+
+        if (hali2cCurrent != NULL) {
+            if (!hali2cAddressed) {
+                hali2cAddressed = hali2cAddress(hali2cCurrent);
+                if (!hali2cAddressed && --hali2cRetry == 0) {
+                    hali2cComplete(I2C_ERROR);
+                }
+            } else if (!hali2cTransferChunk(hali2cCurrent)) {
+                hali2cComplete(I2C_ERROR);
+            } else if (hali2cPos == hali2cCurrent->Len) {
+                hali2cComplete(I2C_SUCCESS);
+            }
+        }
+
+        if (hali2cCurrent != NULL || hali2cQueueCount) {
+            osal_set_event(hali2cTaskID, HAL_I2C_PROCESS_EVT);
+        }
+        return (events ^ HAL_I2C_PROCESS_EVT);
+    }
+    return 0;
+}
+
+// START, address and register, then a repeated START for a read
+static bool hali2cAddress(halI2CTransaction_t *t) {
+    hali2cStart();
+    if (!hali2cSendByte((t->Address << 1) | OCM_WRITE) || !hali2cSendByte(t->Reg)) {
+        hali2cStop();
+        return FALSE;
+    }
+    if (t->Dir == OCM_READ) {
+        hali2cStart();
+        if (!hali2cSendByte((t->Address << 1) | OCM_READ)) {
+            hali2cStop();
+            return FALSE;
+        }
+    }
+    hali2cClock(0);
+    return TRUE;
+}
+
+static bool hali2cTransferChunk(halI2CTransaction_t *t) {
+    uint8 count = HAL_I2C_CHUNK_SIZE;
+
+    while (count-- && hali2cPos < t->Len) {
+        // SCL low before SDA is released, otherwise the slave sees a STOP
+        hali2cClock(0);
+        OCM_DATA_HIGH();
+        if (t->Dir == OCM_READ) {
+            t->Buffer[hali2cPos] = hali2cReceiveByte();
+            // NACK on the last byte tells the slave to release SDA
+            hali2cWrite(hali2cPos + 1 < t->Len ? SMB_ACK : SMB_NAK);
+        } else if (!hali2cSendByte(t->Buffer[hali2cPos])) {
+            hali2cStop();
+            return FALSE;
+        }
+        hali2cPos++;
+    }
+    hali2cClock(0);
+    return TRUE;
+}
+
+static void hali2cComplete(uint8 status) {
+    halI2CTransaction_t *t = hali2cCurrent;
+
+    if (status == I2C_SUCCESS) {
+        hali2cStop();
+    }
+    hali2cCurrent = NULL;
+    t->Status = status;
+    LOG_TRACE("I2C 0x%X reg 0x%X len %d status %d\r\n", t->Address, t->Reg, t->Len, status);
+    if (t->Callback != NULL) {
+        t->Callback(t);
+    }
+}
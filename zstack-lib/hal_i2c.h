@@ -79,4 +79,45 @@ int8   HalI2CSend(uint8 address, uint8 *buf, uint16 len);
 
 int8 I2C_ReadMultByte( uint8 address, uint8 reg, uint8 *buffer, uint16 len );
 int8 I2C_WriteMultByte( uint8 address, uint8 reg, uint8 *buffer, uint16 len );
+
+#define HAL_I2C_PROCESS_EVT 0x0001
+
+/* Register transfer run by the I2C task, see HalI2CQueue */
+typedef struct halI2CTransaction {
+  uint8 Address;            /* 7-bit slave address */
+  uint8 Reg;                /* register the transfer starts at */
+  uint8 Dir;                /* OCM_READ or OCM_WRITE */
+  uint8 *Buffer;
+  uint16 Len;
+  uint8 Status;             /* I2C_SUCCESS or I2C_ERROR in the callback */
+  void (*Callback)(struct halI2CTransaction *transaction);
+} halI2CTransaction_t;
+
+/*********************************************************************
+ * @fn      HalI2CTaskInit
+ * @brief   Initializes the task that runs queued transactions
+ * @param   task_id - OSAL task id
+ * @return  void
+ */
+void HalI2CTaskInit( uint8 task_id );
+
+/*********************************************************************
+ * @fn      HalI2CProcessEvent
+ * @brief   Runs the current transaction a chunk at a time, calls its
+ *          callback when done and starts the next queued one
+ * @param   task_id - OSAL task id
+ * @param   events - events to process
+ * @return  unprocessed events
+ */
+uint16 HalI2CProcessEvent( uint8 task_id, uint16 events );
+
+/*********************************************************************
+ * @fn      HalI2CQueue
+ * @brief   Queues a transaction. The transaction and its buffer must
+ *          stay valid until the callback is called from the I2C task.
+ * @param   t - transaction
+ * @return  I2C_SUCCESS when queued, I2C_ERROR when the queue is full
+ *          or the task is not running
+ */
+int8 HalI2CQueue( halI2CTransaction_t *t );
 #endif
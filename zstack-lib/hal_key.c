@@ -2,6 +2,7 @@
  *                                            INCLUDES
  **************************************************************************************************/
 #include "hal_key.h"
+#define LOG_MODULE LOG_MODULE_KEY
 #include "Debug.h"
 #include "OnBoard.h"
 #include "utils.h"
@@ -46,10 +47,16 @@
  *                                            CONSTANTS
  **************************************************************************************************/
 
-uint8 portNum = 0;
-uint8 pinNum = 0;
+#ifndef HAL_KEY_DEBOUNCE_VALUE
+  #define HAL_KEY_DEBOUNCE_VALUE 25
+#endif
+
+#define HAL_KEY_PORTS 3
+#define HAL_KEY_PORT_INDEX(port) ((port) >> 1)
 
-#define HAL_KEY_DEBOUNCE_VALUE 25
+// Sleep timer runs at 32768 Hz and wraps at 24 bits
+#define HAL_KEY_TICKS_MASK 0x00FFFFFF
+#define HAL_KEY_TICKS_TO_MS(ticks) (((ticks) * 125) >> 12)
 
 #define HAL_KEY_P0_EDGE_BITS HAL_KEY_BIT0
 #define HAL_KEY_P1_EDGE_BITS (HAL_KEY_BIT1 | HAL_KEY_BIT2)
@@ -63,40 +70,147 @@ uint8 pinNum = 0;
  *                                        GLOBAL VARIABLES
  **************************************************************************************************/
 bool Hal_KeyIntEnable;
+uint32 Hal_KeyGlitches[HAL_KEY_PORTS] = {0, 0, 0};
+
+// Debounce state per port. An edge restarts the window, the pins are read
+// once they have been stable for the whole window
+static uint16 halKeyDebounce[HAL_KEY_PORTS] = {HAL_KEY_DEBOUNCE_VALUE, HAL_KEY_DEBOUNCE_VALUE, HAL_KEY_DEBOUNCE_VALUE};
+static uint8 halKeyEdges[HAL_KEY_PORTS] = {0, 0, 0};
+static uint32 halKeyFirstEdge[HAL_KEY_PORTS];
+static uint32 halKeyLastEdge[HAL_KEY_PORTS];
+static uint8 halKeyPressed[HAL_KEY_PORTS] = {0, 0, 0};
+static uint32 halKeyEdgeTime[HAL_KEY_PORTS] = {0, 0, 0};
 /**************************************************************************************************
  *                                        FUNCTIONS - Local
  **************************************************************************************************/
 void halProcessKeyInterrupt(uint8 portNum);
 
-void HalKeyPoll(void) {
-    uint8 pinStatus = 0;
-    bool isPressed = false;
-    switch (portNum) {
-    case HAL_KEY_PORT0:
-        PICTL ^= HAL_KEY_P0_EDGE_BITS; // flip edge bit
-        pinStatus = P0 & pinNum;
-        isPressed = HAL_KEY_P0_INPUT_PINS_EDGE != !!(pinStatus);
-        break;
+static uint32 halKeySleepTimer(void) {
+    uint32 ticks = ST0; // reading ST0 latches ST1 and ST2
+    ticks |= (uint32)ST1 << 8;
+    ticks |= (uint32)ST2 << 16;
+    return ticks;
+}
 
-    case HAL_KEY_PORT1:
-        PICTL ^= HAL_KEY_P1_EDGE_BITS; // flip edge bit
-        pinStatus = P1 & pinNum;
-        isPressed = HAL_KEY_P1_INPUT_PINS_EDGE != !!(pinStatus);
-        break;
+// Pressed pins of the port, the configured edge is the press
+static uint8 halKeyReadPressed(uint8 index) {
+    switch (index) {
+    case 0:
+        return (HAL_KEY_P0_INPUT_PINS_EDGE == HAL_KEY_FALLING_EDGE ? ~P0 : P0) & HAL_KEY_P0_INPUT_PINS;
+    case 1:
+        return (HAL_KEY_P1_INPUT_PINS_EDGE == HAL_KEY_FALLING_EDGE ? ~P1 : P1) & HAL_KEY_P1_INPUT_PINS;
+    case 2:
+        return (HAL_KEY_P2_INPUT_PINS_EDGE == HAL_KEY_FALLING_EDGE ? ~P2 : P2) & HAL_KEY_P2_INPUT_PINS;
+    default:
+        return 0;
+    }
+}
 
-    case HAL_KEY_PORT2:
-        PICTL ^= HAL_KEY_P2_EDGE_BITS; // flip edge bit
-        pinStatus = P2 & pinNum;
-        isPressed = HAL_KEY_P2_INPUT_PINS_EDGE != !!(pinStatus);
-        break;
+// Next interrupt on the release while pressed, on the press otherwise
+static void halKeySetEdge(uint8 index, bool pressed) {
+    uint8 bits;
+    bool falling;
 
-    default:
+    switch (index) {
+    case 0:
+        bits = HAL_KEY_P0_EDGE_BITS;
+        falling = (HAL_KEY_P0_INPUT_PINS_EDGE == HAL_KEY_FALLING_EDGE) != pressed;
+        break;
+    case 1:
+        bits = HAL_KEY_P1_EDGE_BITS;
+        falling = (HAL_KEY_P1_INPUT_PINS_EDGE == HAL_KEY_FALLING_EDGE) != pressed;
         break;
+    case 2:
+        bits = HAL_KEY_P2_EDGE_BITS;
+        falling = (HAL_KEY_P2_INPUT_PINS_EDGE == HAL_KEY_FALLING_EDGE) != pressed;
+        break;
+    default:
+        return;
     }
-    LREP("portNum=0x%X pinNum=0x%X isPressed=%d\r\n", portNum, pinNum, isPressed);
+    if (falling) {
+        PICTL |= bits;
+    } else {
+        PICTL &= ~bits;
+    }
+}
 
-    // LREP("pinStatus=" BYTE_TO_BINARY_PATTERN "\r\n", BYTE_TO_BINARY(pinStatus));
-    OnBoard_SendKeys(pinNum, (isPressed ? HAL_KEY_PRESS : HAL_KEY_RELEASE) | portNum);
+static void halKeyArm(uint16 timeout) {
+    uint32 remaining = osal_get_timeoutEx(Hal_TaskID, HAL_KEY_EVENT);
+    if (remaining == 0 || remaining > timeout) {
+        osal_start_timerEx(Hal_TaskID, HAL_KEY_EVENT, timeout);
+    }
+}
+
+void HalKeyPoll(void) {
+    halIntState_t intState;
+
+    for (uint8 index = 0; index < HAL_KEY_PORTS; index++) {
+        uint8 port = BV(index);
+        uint8 edges, pressed, changed;
+        uint32 now, age, firstEdge, lastEdge;
+
+        // the ISR writes both, a 32-bit read outside may tear
+        HAL_ENTER_CRITICAL_SECTION(intState);
+        edges = halKeyEdges[index];
+        lastEdge = halKeyLastEdge[index];
+        HAL_EXIT_CRITICAL_SECTION(intState);
+        if (edges == 0) {
+            continue;
+        }
+        // read after the snapshot, so no edge is newer than now
+        now = halKeySleepTimer();
+        age = HAL_KEY_TICKS_TO_MS((now - lastEdge) & HAL_KEY_TICKS_MASK);
+        if (age < halKeyDebounce[index]) {
+            halKeyArm(halKeyDebounce[index] - (uint16)age);
+            continue;
+        }
+
+        HAL_ENTER_CRITICAL_SECTION(intState);
+        pressed = halKeyReadPressed(index);
+        halKeySetEdge(index, pressed != 0);
+        edges = halKeyEdges[index];
+        firstEdge = halKeyFirstEdge[index];
+        halKeyEdges[index] = 0;
+        // the pin moved while the edge was switched, start over
+        if (halKeyReadPressed(index) != pressed) {
+            halKeyEdges[index] = 1;
+            halKeyFirstEdge[index] = halKeyLastEdge[index] = now;
+        }
+        HAL_EXIT_CRITICAL_SECTION(intState);
+        if (halKeyEdges[index]) {
+            halKeyArm(halKeyDebounce[index]);
+        }
+
+        // every edge but the one of a real change is a glitch
+        changed = pressed ^ halKeyPressed[index];
+        Hal_KeyGlitches[index] += changed ? edges - 1 : edges;
+        LREP("port=0x%X pressed=0x%X edges=%d\r\n", port, pressed, edges);
+        if (!changed) {
+            continue;
+        }
+
+        halKeyPressed[index] = pressed;
+        halKeyEdgeTime[index] =
+            osal_GetSystemClock() - HAL_KEY_TICKS_TO_MS((now - firstEdge) & HAL_KEY_TICKS_MASK);
+        OnBoard_SendKeys(changed, ((pressed & changed) ? HAL_KEY_PRESS : HAL_KEY_RELEASE) | port);
+    }
+}
+
+void HalKeySetDebounce(uint8 port, uint16 window) {
+    uint8 index = HAL_KEY_PORT_INDEX(port);
+    if (index < HAL_KEY_PORTS) {
+        halKeyDebounce[index] = window;
+    }
+}
+
+uint32 HalKeyEdgeTime(uint8 port) {
+    uint8 index = HAL_KEY_PORT_INDEX(port);
+    return index < HAL_KEY_PORTS ? halKeyEdgeTime[index] : 0;
+}
+
+uint8 HalKeyState(uint8 port) {
+    uint8 index = HAL_KEY_PORT_INDEX(port);
+    return index < HAL_KEY_PORTS ? halKeyPressed[index] : 0;
 }
 
 void HalKeyInit(void) {
@@ -170,24 +284,19 @@ void HalKeyConfig(bool interruptEnable, halKeyCBack_t cback) {
 #endif
 }
 
-void halProcessKeyInterrupt(uint8 _portNum) {
-    portNum = _portNum;
-    switch (_portNum) {
-    case HAL_KEY_PORT0:
-        pinNum = P0IFG & HAL_KEY_P0_INPUT_PINS;
-        break;
-
-    case HAL_KEY_PORT1:
-        pinNum = P1IFG & HAL_KEY_P1_INPUT_PINS;
-        break;
+// Called from the port ISR, only timestamps the edge
+void halProcessKeyInterrupt(uint8 port) {
+    uint8 index = HAL_KEY_PORT_INDEX(port);
+    uint32 now = halKeySleepTimer();
 
-    case HAL_KEY_PORT2:
-        pinNum = P2IFG & HAL_KEY_P2_INPUT_PINS;
-        break;
-    default:
-        break;
+    if (halKeyEdges[index] == 0) {
+        halKeyFirstEdge[index] = now;
+    }
+    if (halKeyEdges[index] < 0xFF) {
+        halKeyEdges[index]++;
     }
-    osal_start_timerEx(Hal_TaskID, HAL_KEY_EVENT, HAL_KEY_DEBOUNCE_VALUE);
+    halKeyLastEdge[index] = now;
+    halKeyArm(halKeyDebounce[index]);
 }
 
 void HalKeyEnterSleep(void) {
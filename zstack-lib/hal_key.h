@@ -111,6 +111,9 @@ typedef void (*halKeyCBack_t) (uint8 keys, uint8 state);
  **************************************************************************************************/
 extern bool Hal_KeyIntEnable;
 
+// Edges rejected by the debounce, per port
+extern uint32 Hal_KeyGlitches[3];
+
 /**************************************************************************************************
  *                                             FUNCTIONS - API
  **************************************************************************************************/
@@ -154,6 +157,22 @@ extern uint8 hal_key_keys(void);
 
 extern uint8 hal_key_int_keys(void);
 
+/*
+ * Debounce window of a port (HAL_KEY_PORTx) in ms. A key event is sent
+ * when the pins have been stable for the window after the last edge
+ */
+extern void HalKeySetDebounce(uint8 port, uint16 window);
+
+/*
+ * osal_GetSystemClock() of the first edge of the last event of a port
+ */
+extern uint32 HalKeyEdgeTime(uint8 port);
+
+/*
+ * Pressed pins of a port as of the last key event, the debounced state
+ */
+extern uint8 HalKeyState(uint8 port);
+
 /**************************************************************************************************
 **************************************************************************************************/
 
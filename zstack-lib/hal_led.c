@@ -51,6 +51,14 @@
 /***************************************************************************************************
  *                                             CONSTANTS
  ***************************************************************************************************/
+#if (HAL_LED == TRUE) && (HAL_LED_PWM == TRUE)
+/* Timer 1 free running at 32 MHz / 8 in modulo mode, 4 MHz / 4096 = 976 Hz PWM */
+#define HAL_LED_PWM_PERIOD    0x0FFF
+#define HAL_LED_PWM_HZ        976
+#define HAL_LED_PWM_T1CTL     0x06    /* DIV = 8, MODE = modulo */
+#define HAL_LED_PWM_T1CCTL    0x04    /* compare mode, no channel interrupt */
+#define HAL_LED_PWM_OVFIF     0x20    /* T1STAT overflow flag */
+#endif
 
 /***************************************************************************************************
  *                                              MACROS
@@ -92,6 +100,14 @@ static uint8 preBlinkState;            // Original State before going to blink m
   static HalLedStatus_t HalLedStatusControl;
 #endif
 
+#if (HAL_LED == TRUE) && (HAL_LED_PWM == TRUE)
+static uint8  halLedPwmBrightness = 0xFF; // brightness of LED1 when it is on
+static uint16 halLedPwmLevel;             // current output, brightness << 8
+static int16  halLedPwmStep;              // added to halLedPwmLevel every PWM period of a fade
+static uint16 halLedPwmPeriods;           // PWM periods left in the fade
+static uint8  halLedPwmTarget;            // brightness at the end of the fade
+#endif
+
 /***************************************************************************************************
  *                                            LOCAL FUNCTION
  ***************************************************************************************************/
@@ -99,6 +115,10 @@ static uint8 preBlinkState;            // Original State before going to blink m
 void HalLedUpdate (void);
 void HalLedOnOff (uint8 leds, uint8 mode);
 #endif /* HAL_LED */
+#if (HAL_LED == TRUE) && (HAL_LED_PWM == TRUE)
+static void halLedPwmInit (void);
+static void halLedPwmOutput (uint8 brightness);
+#endif
 
 /***************************************************************************************************
  *                                            FUNCTIONS - API
@@ -116,6 +136,9 @@ void HalLedOnOff (uint8 leds, uint8 mode);
 void HalLedInit (void)
 {
 #if (HAL_LED == TRUE)
+#if (HAL_LED_PWM == TRUE)
+  halLedPwmInit();
+#endif
   /* Initialize all LEDs to OFF */
   HalLedSet (HAL_LED_ALL, HAL_LED_MODE_OFF);
 #endif /* HAL_LED */
@@ -379,6 +402,10 @@ void HalLedOnOff (uint8 leds, uint8 mode)
 {
   if (leds & HAL_LED_1)
   {
+#if (HAL_LED_PWM == TRUE)
+    T1IE = 0;  /* stop a fade */
+    halLedPwmOutput((mode == HAL_LED_MODE_ON) ? halLedPwmBrightness : 0);
+#else
     if (mode == HAL_LED_MODE_ON)
     {
       HAL_TURN_ON_LED1();
@@ -387,6 +414,7 @@ void HalLedOnOff (uint8 leds, uint8 mode)
     {
       HAL_TURN_OFF_LED1();
     }
+#endif
   }
 
   if (leds & HAL_LED_2)
@@ -425,6 +453,150 @@ void HalLedOnOff (uint8 leds, uint8 mode)
 }
 #endif /* HAL_LED */
 
+/***************************************************************************************************
+ * @fn      HalLedSetBrightness
+ *
+ * @brief   Fade LED1 to the given brightness. Without the PWM backend any
+ *          brightness above 0 is on.
+ *
+ * @param   brightness - 0 (off) to 255, also used by HAL_LED_MODE_ON later
+ *          fadeTime   - fade duration in milliseconds, 0 to set at once
+ *
+ * @return  none
+ ***************************************************************************************************/
+void HalLedSetBrightness (uint8 brightness, uint16 fadeTime)
+{
+#if (HAL_LED == TRUE) && (HAL_LED_PWM == TRUE)
+  uint16 periods = (uint16)(((uint32)fadeTime * HAL_LED_PWM_HZ) / 1000);
+  halIntState_t intState;
+
+  if (brightness)
+  {
+    halLedPwmBrightness = brightness;
+  }
+
+#ifdef BLINK_LEDS
+  /* Keep HalLedSet bookkeeping, a running blink is cancelled */
+  HalLedStatusControl.HalLedControlTable[0].mode = brightness ? HAL_LED_MODE_ON : HAL_LED_MODE_OFF;
+  preBlinkState &= ~HAL_LED_1;
+#endif
+  if (brightness)
+  {
+    HalLedState |= HAL_LED_1;
+  }
+  else
+  {
+    HalLedState &= ~HAL_LED_1;
+  }
+
+  HAL_ENTER_CRITICAL_SECTION(intState);
+  if (periods < 2 || (halLedPwmLevel >> 8) == brightness)
+  {
+    T1IE = 0;
+    halLedPwmOutput(brightness);
+  }
+  else
+  {
+    /* Steps are done by the Timer 1 overflow interrupt, the OSAL loop is not involved */
+    halLedPwmStep = (int16)((((int32)brightness << 8) - (int32)halLedPwmLevel) / periods);
+    halLedPwmPeriods = periods;
+    halLedPwmTarget = brightness;
+    T1STAT = ~HAL_LED_PWM_OVFIF;
+    T1IF = 0;
+    T1IE = 1;
+  }
+  HAL_EXIT_CRITICAL_SECTION(intState);
+#else
+  (void) fadeTime;
+  HalLedSet (HAL_LED_1, brightness ? HAL_LED_MODE_ON : HAL_LED_MODE_OFF);
+#endif
+}
+
+#if (HAL_LED == TRUE) && (HAL_LED_PWM == TRUE)
+/***************************************************************************************************
+ * @fn      halLedPwmInit
+ *
+ * @brief   Start Timer 1 as the PWM source of LED1, the pin stays GPIO while LED1 is off
+ *
+ * @param   none
+ *
+ * @return  none
+ ***************************************************************************************************/
+static void halLedPwmInit (void)
+{
+  HAL_LED_PWM_PINS();
+  T1CC0L = LO_UINT16(HAL_LED_PWM_PERIOD);
+  T1CC0H = HI_UINT16(HAL_LED_PWM_PERIOD);
+  T1CCTL0 = 0;
+  T1CCTL2 = HAL_LED_PWM_T1CCTL | HAL_LED_PWM_CMP;
+  T1CTL = HAL_LED_PWM_T1CTL;
+  halLedPwmLevel = 0;
+}
+
+/***************************************************************************************************
+ * @fn      halLedPwmOutput
+ *
+ * @brief   Set the LED1 duty cycle. Brightness is squared for a perceptually even scale,
+ *          0 and full brightness drive the pin as GPIO.
+ *
+ * @param   brightness - 0 to 255
+ *
+ * @return  none
+ ***************************************************************************************************/
+static void halLedPwmOutput (uint8 brightness)
+{
+  uint16 duty = ((uint16)brightness * brightness) >> 4;
+
+  halLedPwmLevel = (uint16)brightness << 8;
+  if (brightness == 0 || brightness == 0xFF)
+  {
+    HAL_LED_PWM_SEL &= ~HAL_LED_PWM_BV;
+    if (brightness)
+    {
+      HAL_TURN_ON_LED1();
+    }
+    else
+    {
+      HAL_TURN_OFF_LED1();
+    }
+  }
+  else
+  {
+    T1CC2L = LO_UINT16(duty);
+    T1CC2H = HI_UINT16(duty);
+    HAL_LED_PWM_SEL |= HAL_LED_PWM_BV;
+  }
+}
+
+/***************************************************************************************************
+ * @fn      halLedPwmIsr
+ *
+ * @brief   One fade step per PWM period, the interrupt is disabled when the fade is done
+ ***************************************************************************************************/
+HAL_ISR_FUNCTION(halLedPwmIsr, T1_VECTOR)
+{
+  HAL_ENTER_ISR();
+
+  T1STAT = ~HAL_LED_PWM_OVFIF;
+  T1IF = 0;
+
+  if (--halLedPwmPeriods)
+  {
+    uint16 level = halLedPwmLevel + halLedPwmStep;
+    halLedPwmOutput(level >> 8);
+    halLedPwmLevel = level;
+  }
+  else
+  {
+    /* the step is rounded, land exactly on the target */
+    T1IE = 0;
+    halLedPwmOutput(halLedPwmTarget);
+  }
+
+  HAL_EXIT_ISR();
+}
+#endif
+
 /***************************************************************************************************
  * @fn      HalGetLedState
  *
@@ -79,6 +79,10 @@ extern "C"
 #define HAL_LED_DEFAULT_FLASH_COUNT   50
 #define HAL_LED_DEFAULT_FLASH_TIME    1000
 
+#ifndef HAL_LED_PWM
+#define HAL_LED_PWM FALSE
+#endif
+
 /*********************************************************************
  * TYPEDEFS
  */
@@ -103,6 +107,11 @@ extern uint8 HalLedSet( uint8 led, uint8 mode );
  */
 extern void HalLedBlink( uint8 leds, uint8 cnt, uint8 duty, uint16 time );
 
+/*
+ * Fade LED1 to brightness 0-255, PWM on Timer 1 with HAL_LED_PWM
+ */
+extern void HalLedSetBrightness( uint8 brightness, uint16 fadeTime );
+
 /*
  * Put LEDs in sleep state - store current values
  */
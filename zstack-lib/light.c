@@ -0,0 +1,52 @@
+#define LOG_MODULE LOG_MODULE_LIGHT
+#include "Debug.h"
+#include "adc_sampler.h"
+#include "hal_adc.h"
+#include "light.h"
+#include "utils.h"
+
+static CONST curvePoint_t lightCalibration[] = LIGHT_CALIBRATION;
+#define LIGHT_CALIBRATION_LENGTH (sizeof(lightCalibration) / sizeof(lightCalibration[0]))
+
+uint16 zclLight_RawAdc = 0;
+
+static void lightSampled(adcSamplerRequest_t *request);
+
+static adcSamplerRequest_t lightRequest = {.Channels = BV(LIGHT_ADC_CHANNEL),
+                                           .Resolution = LIGHT_ADC_RESOLUTION,
+                                           .Reference = LIGHT_ADC_REFERENCE,
+                                           .Oversampling = LIGHT_OVERSAMPLING_SHIFT,
+                                           .Decimation = 0,
+                                           .Callback = lightSampled};
+static lightCallback_t lightCallback = NULL;
+
+uint16 lightMeasuredValue(uint16 raw) {
+    return curveInterpolate(lightCalibration, LIGHT_CALIBRATION_LENGTH, raw);
+}
+
+bool lightRead(lightCallback_t callback) {
+    if (lightCallback != NULL) {
+        return FALSE;
+    }
+    lightCallback = callback;
+    if (!adcSampler_Queue(&lightRequest)) {
+        lightCallback = NULL;
+        return FALSE;
+    }
+    return TRUE;
+}
+
+static void lightSampled(adcSamplerRequest_t *request) {
+    lightCallback_t callback = lightCallback;
+    uint16 value = 0xFFFF;
+
+    lightCallback = NULL;
+    if (request->Status == ADC_SAMPLER_SUCCESS) {
+        zclLight_RawAdc = request->Results[LIGHT_ADC_CHANNEL];
+        value = lightMeasuredValue(zclLight_RawAdc);
+    }
+    LREP("Light raw=%d value=%d status=%d\r\n", zclLight_RawAdc, value, request->Status);
+    if (callback != NULL) {
+        callback(value);
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef LIGHT_H
+#define LIGHT_H
+
+// Photoresistor divider on an ADC pin, sampled in the background by the ADC
+// sampler and mapped to the ZCL illuminance MeasuredValue by a calibration
+// curve.
+#ifndef LIGHT_ADC_CHANNEL
+#define LIGHT_ADC_CHANNEL HAL_ADC_CHANNEL_7
+#endif
+
+#ifndef LIGHT_ADC_RESOLUTION
+#define LIGHT_ADC_RESOLUTION HAL_ADC_RESOLUTION_12
+#endif
+
+#ifndef LIGHT_ADC_REFERENCE
+#define LIGHT_ADC_REFERENCE HAL_ADC_REF_AVDD
+#endif
+
+#ifdef LIGHT_OVERSAMPLING
+#error "LIGHT_OVERSAMPLING was a sample count, set LIGHT_OVERSAMPLING_SHIFT (log2 of the count) instead"
+#endif
+#ifndef LIGHT_OVERSAMPLING_SHIFT
+#define LIGHT_OVERSAMPLING_SHIFT 4 // 2^4 samples averaged
+#endif
+
+// {raw reading, MeasuredValue} points, raw readings in ascending order,
+// linear between the points and clamped outside. MeasuredValue is
+// 10000 * log10(lux) + 1, 0 - too dark to measure. The default is a GL5528 from the pin to AVDD with 10k to ground,
+// a 12-bit reading (0..2047): 1, 3, 10, 30 ... 10000 lux
+#ifndef LIGHT_CALIBRATION
+#define LIGHT_CALIBRATION                                                                                                                  \
+    {                                                                                                                                      \
+        {0, 0}, {256, 1}, {482, 4772}, {854, 10001}, {1243, 14772}, {1601, 20001}, {1813, 24772}, {1939, 30001}, {1996, 34772},            \
+            {2025, 40001}                                                                                                                  \
+    }
+#endif
+
+extern uint16 zclLight_RawAdc;
+
+typedef void (*lightCallback_t)(uint16 measuredValue);
+
+extern uint16 lightMeasuredValue(uint16 raw);
+// Queues a reading, the callback gets the MeasuredValue, 0xFFFF on failure.
+// FALSE while the previous reading is in progress
+extern bool lightRead(lightCallback_t callback);
+#endif
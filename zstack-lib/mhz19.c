@@ -1,50 +1,71 @@
 #include "mhz19.h"
+#define LOG_MODULE LOG_MODULE_MHZ19
 #include "Debug.h"
 #include "OSAL.h"
 #include "OnBoard.h"
 #include "hal_led.h"
 #include "hal_uart.h"
+#include "uart_manager.h"
 
-#ifndef CO2_UART_PORT
-#define CO2_UART_PORT HAL_UART_PORT_1
-#endif
+#ifdef CO2_SENSOR
 
-#define MHZ18_RESPONSE_LENGTH 13
+#define MHZ19_FRAME_LENGTH 9
+#define MHZ19_COMMAND_GET_PPM 0x86
+#define MHZ19_COMMAND_ABC 0x79
 
 static void MHZ19_SetABC(bool isEnabled);
-static void MHZ19_RequestMeasure(void);
+static void MHZ19_RequestMeasure(air_quality_cb_t callback);
 static uint16 MHZ19_Read(void);
+static void MHZ19_MeasureCB(uartTransaction_t *transaction);
 
 zclAirSensor_t MHZ19_dev = {&MHZ19_RequestMeasure, &MHZ19_Read, &MHZ19_SetABC};
 
-uint8 MHZ19_RESPONSE_LENGTH = 9;
-uint8 MHZ19_COMMAND_GET_PPM[] = {0xFF, 0x01, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79};
-uint8 MHZ19_COMMAND_ABC_ENABLE[] = {0xFF, 0x01, 0x79, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xE6};
-uint8 MHZ19_COMMAND_ABC_DISABLE[] = {0xFF, 0x01, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86};
+// the checksum byte is filled in by the UART manager
+static uint8 MHZ19_MeasureRequest[MHZ19_FRAME_LENGTH] = {0xFF, 0x01, MHZ19_COMMAND_GET_PPM, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+static uint8 MHZ19_MeasureResponse[MHZ19_FRAME_LENGTH];
+static uint8 MHZ19_ABCRequest[MHZ19_FRAME_LENGTH] = {0xFF, 0x01, MHZ19_COMMAND_ABC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
-void MHZ19_SetABC(bool isEnabled) {
-    if (isEnabled) {
-        HalUARTWrite(CO2_UART_PORT, MHZ19_COMMAND_ABC_ENABLE, sizeof(MHZ19_COMMAND_ABC_ENABLE) / sizeof(MHZ19_COMMAND_ABC_ENABLE[0]));
-    } else {
-        HalUARTWrite(CO2_UART_PORT, MHZ19_COMMAND_ABC_DISABLE, sizeof(MHZ19_COMMAND_ABC_DISABLE) / sizeof(MHZ19_COMMAND_ABC_DISABLE[0]));
+static uartTransaction_t MHZ19_Measure = {CO2_UART_PORT, UART_FRAME_MHZ19, MHZ19_MeasureRequest, MHZ19_FRAME_LENGTH,
+                                          MHZ19_MeasureResponse, MHZ19_FRAME_LENGTH, CO2_UART_TIMEOUT, CO2_UART_RETRIES,
+                                          UART_MANAGER_SUCCESS, MHZ19_MeasureCB};
+// the sensor does not answer the ABC command
+static uartTransaction_t MHZ19_ABC = {CO2_UART_PORT, UART_FRAME_MHZ19, MHZ19_ABCRequest, MHZ19_FRAME_LENGTH, NULL, 0,
+                                      CO2_UART_TIMEOUT, 0, UART_MANAGER_SUCCESS, NULL};
+
+static bool MHZ19_Busy = FALSE;
+static uint16 MHZ19_Ppm = AIR_QUALITY_INVALID_RESPONSE;
+static air_quality_cb_t MHZ19_Callback = NULL;
+
+static void MHZ19_SetABC(bool isEnabled) {
+    if (uartManager_Open(CO2_UART_PORT, HAL_UART_BR_9600)) {
+        MHZ19_ABCRequest[3] = isEnabled ? 0xA0 : 0x00;
+        uartManager_Queue(&MHZ19_ABC);
     }
 }
 
-void MHZ19_RequestMeasure(void) {
-    HalUARTWrite(CO2_UART_PORT, MHZ19_COMMAND_GET_PPM, sizeof(MHZ19_COMMAND_GET_PPM) / sizeof(MHZ19_COMMAND_GET_PPM[0]));
+static void MHZ19_RequestMeasure(air_quality_cb_t callback) {
+    if (MHZ19_Busy || !uartManager_Open(CO2_UART_PORT, HAL_UART_BR_9600)) {
+        return;
+    }
+    MHZ19_Callback = callback;
+    MHZ19_Busy = uartManager_Queue(&MHZ19_Measure);
 }
 
-uint16 MHZ19_Read(void) {
-    uint8 response[MHZ18_RESPONSE_LENGTH];
-    HalUARTRead(CO2_UART_PORT, (uint8 *)&response, sizeof(response) / sizeof(response[0]));
-
-    if (response[0] != 0xFF || response[1] != 0x86) {
-        LREPMaster("MHZ18 Invalid response\r\n");
+static void MHZ19_MeasureCB(uartTransaction_t *transaction) {
+    MHZ19_Busy = FALSE;
+    if (transaction->Status != UART_MANAGER_SUCCESS) {
+        LREP("MHZ19 no response status=%d\r\n", transaction->Status);
         HalLedSet(HAL_LED_ALL, HAL_LED_MODE_FLASH);
-        return AIR_QUALITY_INVALID_RESPONSE;
+        MHZ19_Ppm = AIR_QUALITY_INVALID_RESPONSE;
+    } else {
+        MHZ19_Ppm = BUILD_UINT16(MHZ19_MeasureResponse[3], MHZ19_MeasureResponse[2]);
+        LREP("MHZ19 Received CO₂=%d ppm\r\n", MHZ19_Ppm);
+    }
+    if (MHZ19_Callback != NULL) {
+        MHZ19_Callback(MHZ19_Ppm);
     }
+}
 
-    const uint16 ppm = (((uint16)response[2]) << 8) | response[3];
-    LREP("MHZ18 Received CO₂=%d ppm\r\n", ppm);
-    return ppm;
-}
\ No newline at end of file
+static uint16 MHZ19_Read(void) { return MHZ19_Ppm; }
+
+#endif
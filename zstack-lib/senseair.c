@@ -1,51 +1,93 @@
 #include "senseair.h"
+#define LOG_MODULE LOG_MODULE_SENSEAIR
 #include "Debug.h"
 #include "OSAL.h"
 #include "OnBoard.h"
 #include "hal_led.h"
 #include "hal_uart.h"
+#include "uart_manager.h"
 
-#ifndef CO2_UART_PORT
-#define CO2_UART_PORT HAL_UART_PORT_1
-#endif
+#ifdef CO2_SENSOR
+
+// Modbus address "any sensor", function and register map of the S8 / K30
+#define SENSEAIR_ADDRESS 0xFE
+#define SENSEAIR_READ_INPUT 0x04
+#define SENSEAIR_WRITE_HOLDING 0x06
+#define SENSEAIR_ABC_PERIOD_REGISTER 0x001F
+#define SENSEAIR_ABC_PERIOD 180 // hours
+
+#define SENSEAIR_REQUEST_LENGTH 8
+// address, function, byte count, 4 input registers (status .. CO2), CRC
+#define SENSEAIR_INPUT_REGISTERS 4
+#define SENSEAIR_RESPONSE_LENGTH (3 + SENSEAIR_INPUT_REGISTERS * 2 + 2)
 
-static void SenseAir_RequestMeasure(void);
+static void SenseAir_RequestMeasure(air_quality_cb_t callback);
 static uint16 SenseAir_Read(void);
 static void SenseAir_SetABC(bool isEnabled);
+static void SenseAir_MeasureCB(uartTransaction_t *transaction);
 
-extern zclAirSensor_t sense_air_dev = {&SenseAir_RequestMeasure, &SenseAir_Read, &SenseAir_SetABC};
+zclAirSensor_t sense_air_dev = {&SenseAir_RequestMeasure, &SenseAir_Read, &SenseAir_SetABC};
 
-#define SENSEAIR_RESPONSE_LENGTH 13
+// the CRC is filled in by the UART manager
+static uint8 SenseAir_MeasureRequest[SENSEAIR_REQUEST_LENGTH] = {
+    SENSEAIR_ADDRESS, SENSEAIR_READ_INPUT, 0x00, 0x00, 0x00, SENSEAIR_INPUT_REGISTERS, 0x00, 0x00};
+static uint8 SenseAir_MeasureResponse[SENSEAIR_RESPONSE_LENGTH];
+static uint8 SenseAir_ABCRequest[SENSEAIR_REQUEST_LENGTH] = {SENSEAIR_ADDRESS,
+                                                             SENSEAIR_WRITE_HOLDING,
+                                                             HI_UINT16(SENSEAIR_ABC_PERIOD_REGISTER),
+                                                             LO_UINT16(SENSEAIR_ABC_PERIOD_REGISTER),
+                                                             0x00,
+                                                             0x00,
+                                                             0x00,
+                                                             0x00};
+// a register write is answered with its echo
+static uint8 SenseAir_ABCResponse[SENSEAIR_REQUEST_LENGTH];
 
-uint8 readCO2[] = {0xFE, 0x04, 0x00, 0x00, 0x00, 0x04, 0xE5, 0xC6};
-uint8 disableABC[] = {0xFE, 0x06, 0x00, 0x1F, 0x00, 0x00, 0xAC, 0x03};
-uint8 enableABC[] = {0xFE, 0x06, 0x00, 0x1F, 0x00, 0xB4, 0xAC, 0x74};
+static uartTransaction_t SenseAir_Measure = {CO2_UART_PORT, UART_FRAME_MODBUS, SenseAir_MeasureRequest,
+                                             SENSEAIR_REQUEST_LENGTH, SenseAir_MeasureResponse, SENSEAIR_RESPONSE_LENGTH,
+                                             CO2_UART_TIMEOUT, CO2_UART_RETRIES, UART_MANAGER_SUCCESS, SenseAir_MeasureCB};
+static uartTransaction_t SenseAir_ABC = {CO2_UART_PORT, UART_FRAME_MODBUS, SenseAir_ABCRequest, SENSEAIR_REQUEST_LENGTH,
+                                         SenseAir_ABCResponse, SENSEAIR_REQUEST_LENGTH, CO2_UART_TIMEOUT,
+                                         CO2_UART_RETRIES, UART_MANAGER_SUCCESS, NULL};
 
-void SenseAir_SetABC(bool isEnabled) {
-    if (isEnabled) {
-        HalUARTWrite(CO2_UART_PORT, enableABC, sizeof(enableABC) / sizeof(enableABC[0]));
-    } else {
-        HalUARTWrite(CO2_UART_PORT, disableABC, sizeof(disableABC) / sizeof(disableABC[0]));
+static bool SenseAir_Busy = FALSE;
+static uint16 SenseAir_Ppm = AIR_QUALITY_INVALID_RESPONSE;
+static air_quality_cb_t SenseAir_Callback = NULL;
+
+static void SenseAir_SetABC(bool isEnabled) {
+    if (uartManager_Open(CO2_UART_PORT, HAL_UART_BR_9600)) {
+        SenseAir_ABCRequest[4] = HI_UINT16(isEnabled ? SENSEAIR_ABC_PERIOD : 0);
+        SenseAir_ABCRequest[5] = LO_UINT16(isEnabled ? SENSEAIR_ABC_PERIOD : 0);
+        uartManager_Queue(&SenseAir_ABC);
     }
 }
 
-void SenseAir_RequestMeasure(void) {
-    HalUARTWrite(CO2_UART_PORT, readCO2, sizeof(readCO2) / sizeof(readCO2[0])); 
+static void SenseAir_RequestMeasure(air_quality_cb_t callback) {
+    if (SenseAir_Busy || !uartManager_Open(CO2_UART_PORT, HAL_UART_BR_9600)) {
+        return;
+    }
+    SenseAir_Callback = callback;
+    SenseAir_Busy = uartManager_Queue(&SenseAir_Measure);
 }
 
-uint16 SenseAir_Read(void) {
-    uint8 response[SENSEAIR_RESPONSE_LENGTH];
-    HalUARTRead(CO2_UART_PORT, (uint8 *)&response, sizeof(response) / sizeof(response[0]));
+static void SenseAir_MeasureCB(uartTransaction_t *transaction) {
+    uint8 *response = SenseAir_MeasureResponse;
 
-    if (response[0] != 0xFE || response[1] != 0x04) {
-        LREPMaster("Invalid response\r\n");
-        return AIR_QUALITY_INVALID_RESPONSE;
+    SenseAir_Busy = FALSE;
+    if (transaction->Status != UART_MANAGER_SUCCESS || response[2] != SENSEAIR_INPUT_REGISTERS * 2) {
+        LREP("SenseAir invalid response status=%d\r\n", transaction->Status);
+        SenseAir_Ppm = AIR_QUALITY_INVALID_RESPONSE;
+    } else {
+        const uint16 status = BUILD_UINT16(response[4], response[3]);
+        // the last input register is the CO2
+        SenseAir_Ppm = BUILD_UINT16(response[2 + SENSEAIR_INPUT_REGISTERS * 2], response[1 + SENSEAIR_INPUT_REGISTERS * 2]);
+        LREP("SenseAir Received CO₂=%d ppm Status=0x%X\r\n", SenseAir_Ppm, status);
+    }
+    if (SenseAir_Callback != NULL) {
+        SenseAir_Callback(SenseAir_Ppm);
     }
+}
 
-    const uint8 length = response[2];
-    const uint16 status = (((uint16)response[3]) << 8) | response[4];
-    const uint16 ppm = (((uint16)response[length + 1]) << 8) | response[length + 2];
+static uint16 SenseAir_Read(void) { return SenseAir_Ppm; }
 
-    LREP("SenseAir Received CO₂=%d ppm Status=0x%X\r\n", ppm, status);
-    return ppm;
-}
\ No newline at end of file
+#endif
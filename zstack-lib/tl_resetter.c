@@ -1,4 +1,5 @@
 #include "tl_resetter.h"
+#define LOG_MODULE LOG_MODULE_TL_RESETTER
 #include "Debug.h"
 #include "Osal_Memory.h"
 #include "bdb.h"
@@ -0,0 +1,239 @@
+#include "uart_manager.h"
+#include "OSAL.h"
+#include "hal_uart.h"
+#include "utils.h"
+
+#if UART_MANAGER
+
+#define UART_MANAGER_PORTS 2
+#define UART_MANAGER_BUFFER_SIZE 32
+
+// Modbus exception response: address, function | 0x80, code, CRC16
+#define MODBUS_EXCEPTION_LENGTH 5
+
+static uint8 uartManager_TaskID = 0xFF;
+static uint8 uartManager_Opened = 0; // port bit mask
+
+static uartTransaction_t *uartManager_Queued[UART_MANAGER_QUEUE_SIZE];
+static uint8 uartManager_QueueHead = 0;
+static uint8 uartManager_QueueCount = 0;
+
+static uartTransaction_t *uartManager_Current = NULL;
+static uint8 uartManager_Tries;
+static uint8 uartManager_Received;
+static bool uartManager_Done;
+
+static void uartManager_PortCB(uint8 port, uint8 event);
+static void uartManager_Send(void);
+static void uartManager_Receive(uint8 byte);
+static bool uartManager_Check(uint8 *frame, uint8 len, uint8 type);
+static void uartManager_Seal(uint8 *frame, uint8 len, uint8 type);
+static void uartManager_Complete(uint8 status);
+
+void uartManager_Init(uint8 task_id) { uartManager_TaskID = task_id; }
+
+bool uartManager_Open(uint8 port, uint8 baudRate) {
+    halUARTCfg_t config;
+
+    if (port >= UART_MANAGER_PORTS) {
+        return FALSE;
+    }
+    if (uartManager_Opened & BV(port)) {
+        return TRUE;
+    }
+    osal_memset(&config, 0, sizeof(config));
+    config.configured = TRUE;
+    config.baudRate = baudRate;
+    config.flowControl = FALSE;
+    config.idleTimeout = 6;
+    config.rx.maxBufSize = UART_MANAGER_BUFFER_SIZE;
+    config.tx.maxBufSize = UART_MANAGER_BUFFER_SIZE;
+    config.intEnable = TRUE;
+    config.callBackFunc = uartManager_PortCB;
+    if (HalUARTOpen(port, &config) != HAL_UART_SUCCESS) {
+        return FALSE;
+    }
+    uartManager_Opened |= BV(port);
+    return TRUE;
+}
+
+bool uartManager_Queue(uartTransaction_t *transaction) {
+    if (uartManager_TaskID == 0xFF || transaction->Port >= UART_MANAGER_PORTS ||
+        !(uartManager_Opened & BV(transaction->Port)) || uartManager_QueueCount == UART_MANAGER_QUEUE_SIZE) {
+        return FALSE;
+    }
+    uartManager_Queued[(uartManager_QueueHead + uartManager_QueueCount) % UART_MANAGER_QUEUE_SIZE] = transaction;
+    uartManager_QueueCount++;
+    if (uartManager_Current == NULL) {
+        osal_set_event(uartManager_TaskID, UART_MANAGER_EVT);
+    }
+    return TRUE;
+}
+
+static void uartManager_Complete(uint8 status) {
+    uartTransaction_t *current = uartManager_Current;
+
+    osal_stop_timerEx(uartManager_TaskID, UART_MANAGER_TIMEOUT_EVT);
+    uartManager_Current = NULL;
+    current->Status = status;
+    if (current->Callback) {
+        current->Callback(current);
+    }
+}
+
+uint16 uartManager_event_loop(uint8 task_id, uint16 events) {
+    uartTransaction_t *current = uartManager_Current;
+
+    if (events & UART_MANAGER_TIMEOUT_EVT) {
+        if (current != NULL && !uartManager_Done) {
+            if (uartManager_Tries <= current->Retries) {
+                uartManager_Send();
+            } else {
+                uartManager_Complete(UART_MANAGER_TIMEOUT);
+                osal_set_event(uartManager_TaskID, UART_MANAGER_EVT);
+            }
+        }
+        return (events ^ UART_MANAGER_TIMEOUT_EVT);
+    }
+    if (events & UART_MANAGER_EVT) {
+        if (current != NULL && uartManager_Done) {
+            uartManager_Complete(current->Status);
+        }
+        if (uartManager_Current == NULL && uartManager_QueueCount) {
+            uartManager_Current = uartManager_Queued[uartManager_QueueHead];
+            uartManager_QueueHead = (uartManager_QueueHead + 1) % UART_MANAGER_QUEUE_SIZE;
+            uartManager_QueueCount--;
+            uartManager_Tries = 0;
+            uartManager_Seal(uartManager_Current->Request, uartManager_Current->RequestLen, uartManager_Current->Frame);
+            uartManager_Send();
+        }
+        return (events ^ UART_MANAGER_EVT);
+    }
+    return 0;
+}
+
+// Drops what is left of the previous response and writes the request again
+static void uartManager_Send(void) {
+    uartTransaction_t *current = uartManager_Current;
+    uint8 byte;
+
+    while (HalUARTRead(current->Port, &byte, 1)) {
+    }
+    uartManager_Tries++;
+    uartManager_Received = 0;
+    current->Status = UART_MANAGER_SUCCESS;
+    HalUARTWrite(current->Port, current->Request, current->RequestLen);
+    // nothing to wait for, done once written
+    uartManager_Done = (current->ResponseLen == 0);
+    if (uartManager_Done) {
+        osal_set_event(uartManager_TaskID, UART_MANAGER_EVT);
+    } else {
+        osal_start_timerEx(uartManager_TaskID, UART_MANAGER_TIMEOUT_EVT, current->Timeout);
+    }
+}
+
+static void uartManager_PortCB(uint8 port, uint8 event) {
+    uint8 byte;
+
+    (void)event;
+    while (HalUARTRead(port, &byte, 1)) {
+        // bytes of other ports and after the response are dropped
+        if (uartManager_Current != NULL && uartManager_Current->Port == port && !uartManager_Done) {
+            uartManager_Receive(byte);
+        }
+    }
+}
+
+// Start byte and the command byte the response must have
+static uint8 uartManager_Header(uartTransaction_t *transaction, uint8 index) {
+    if (transaction->Frame == UART_FRAME_MHZ19) {
+        // 0xFF, then the command of the request
+        return index ? transaction->Request[2] : 0xFF;
+    }
+    // Modbus address and function
+    return transaction->Request[index];
+}
+
+static void uartManager_Receive(uint8 byte) {
+    uartTransaction_t *current = uartManager_Current;
+    uint8 *frame = current->Response;
+
+    // the response starts as the request, anything else is noise or the
+    // tail of an older response
+    if (uartManager_Received < 2 && byte != uartManager_Header(current, uartManager_Received) &&
+        !(current->Frame == UART_FRAME_MODBUS && uartManager_Received == 1 && byte == (current->Request[1] | 0x80))) {
+        uartManager_Received = 0;
+        if (byte != uartManager_Header(current, 0)) {
+            return;
+        }
+    }
+    frame[uartManager_Received++] = byte;
+
+    if (current->Frame == UART_FRAME_MODBUS && uartManager_Received == MODBUS_EXCEPTION_LENGTH && (frame[1] & 0x80)) {
+        if (uartManager_Check(frame, MODBUS_EXCEPTION_LENGTH, UART_FRAME_MODBUS)) {
+            current->Status = UART_MANAGER_ERROR;
+            uartManager_Done = TRUE;
+            osal_set_event(uartManager_TaskID, UART_MANAGER_EVT);
+        } else {
+            uartManager_Received = 0;
+        }
+        return;
+    }
+    if (uartManager_Received == current->ResponseLen) {
+        if (uartManager_Check(frame, current->ResponseLen, current->Frame)) {
+            uartManager_Done = TRUE;
+            osal_set_event(uartManager_TaskID, UART_MANAGER_EVT);
+        } else {
+            // broken frame, wait for a retry or the timeout
+            uartManager_Received = 0;
+        }
+    }
+}
+
+static uint8 uartManager_Mhz19Checksum(uint8 *frame) {
+    uint8 sum = 0;
+    for (uint8 i = 1; i < 8; i++) {
+        sum += frame[i];
+    }
+    return (uint8)(0xFF - sum + 1);
+}
+
+static bool uartManager_Check(uint8 *frame, uint8 len, uint8 type) {
+    uint16 crc;
+
+    switch (type) {
+    case UART_FRAME_MHZ19:
+        return len == 9 && frame[8] == uartManager_Mhz19Checksum(frame);
+    case UART_FRAME_MODBUS:
+        if (len <= 2) {
+            return FALSE;
+        }
+        crc = crc16Modbus(frame, len - 2);
+        return frame[len - 2] == LO_UINT16(crc) && frame[len - 1] == HI_UINT16(crc);
+    default:
+        return TRUE;
+    }
+}
+
+static void uartManager_Seal(uint8 *frame, uint8 len, uint8 type) {
+    uint16 crc;
+
+    switch (type) {
+    case UART_FRAME_MHZ19:
+        if (len == 9) {
+            frame[8] = uartManager_Mhz19Checksum(frame);
+        }
+        break;
+    case UART_FRAME_MODBUS:
+        if (len > 2) {
+            crc = crc16Modbus(frame, len - 2);
+            frame[len - 2] = LO_UINT16(crc);
+            frame[len - 1] = HI_UINT16(crc);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef UART_MANAGER_H
+#define UART_MANAGER_H
+
+// Request/response transactions with devices on a UART. The manager owns
+// the ports it opens: transactions of all devices are queued and run one
+// at a time, so several devices can share a port (e.g. Modbus addresses on
+// one line). A response is matched to its request by the header bytes and
+// its checksum, a missing or broken one is retried after the timeout.
+//
+// A port opened here must not be opened by anyone else, the HAL has one
+// callback per port.
+#ifndef UART_MANAGER
+#define UART_MANAGER FALSE
+#endif
+
+#define UART_MANAGER_EVT         0x0001
+#define UART_MANAGER_TIMEOUT_EVT 0x0002
+
+#ifndef UART_MANAGER_QUEUE_SIZE
+#define UART_MANAGER_QUEUE_SIZE 4
+#endif
+
+#define UART_MANAGER_SUCCESS 0
+#define UART_MANAGER_TIMEOUT 1 // no complete response after all tries
+#define UART_MANAGER_ERROR   2 // the device answered with an error
+
+// How the last bytes of a frame are checked and what header must match
+#define UART_FRAME_RAW   0 // no check, write only transactions
+#define UART_FRAME_MHZ19 1 // 0xFF start, command echo, 0x100 - sum of bytes 1..7
+#define UART_FRAME_MODBUS 2 // address and function echo, CRC16 low byte first
+
+typedef struct uartTransaction {
+    uint8 Port;        // HAL_UART_PORT_*
+    uint8 Frame;       // UART_FRAME_*
+    uint8 *Request;    // the check bytes are filled in by the manager
+    uint8 RequestLen;
+    uint8 *Response;
+    uint8 ResponseLen; // full frame, 0 - nothing is expected
+    uint16 Timeout;    // ms per try
+    uint8 Retries;
+    uint8 Status;      // UART_MANAGER_* in the callback
+    void (*Callback)(struct uartTransaction *transaction);
+} uartTransaction_t;
+
+extern void uartManager_Init(uint8 task_id);
+extern uint16 uartManager_event_loop(uint8 task_id, uint16 events);
+// Opens the port for the manager, does nothing when it is open already
+extern bool uartManager_Open(uint8 port, uint8 baudRate);
+// The transaction and its buffers must stay valid until its callback.
+// FALSE when the queue is full or the port is not open
+extern bool uartManager_Queue(uartTransaction_t *transaction);
+#endif
@@ -4,11 +4,32 @@
 // #define MAX(x, y) (((x) > (y)) ? (x) : (y))
 // #define MIN(x, y) (((x) < (y)) ? (x) : (y))
 
-double mapRange(double a1, double a2, double b1, double b2, double s) {
-    double result = b1 + (s - a1) * (b2 - b1) / (a2 - a1);
+int32 mapRange(int32 a1, int32 a2, int32 b1, int32 b2, int32 s) {
+    int32 num = (s - a1) * (b2 - b1);
+    int32 den = a2 - a1;
+    // rounded to nearest, the division truncates towards zero
+    int32 result = b1 + (((num < 0) == (den < 0)) ? (num + den / 2) / den : (num - den / 2) / den);
     return MIN(b2, MAX(result, b1));
 }
 
+uint16 curveInterpolate(CONST curvePoint_t *curve, uint8 length, uint16 x) {
+    uint8 i = 1;
+
+    if (x <= curve[0].X) {
+        return curve[0].Y;
+    }
+    while (i < length && x > curve[i].X) {
+        i++;
+    }
+    if (i == length) {
+        return curve[length - 1].Y;
+    }
+    if (curve[i].Y >= curve[i - 1].Y) {
+        return curve[i - 1].Y + (uint16)((uint32)(x - curve[i - 1].X) * (curve[i].Y - curve[i - 1].Y) / (curve[i].X - curve[i - 1].X));
+    }
+    return curve[i - 1].Y - (uint16)((uint32)(x - curve[i - 1].X) * (curve[i - 1].Y - curve[i].Y) / (curve[i].X - curve[i - 1].X));
+}
+
 uint16 adcReadSampled(uint8 channel, uint8 resolution, uint8 reference, uint8 samplesCount) {
     HalAdcSetReference(reference);
     uint32 samplesSum = 0;
@@ -17,3 +38,92 @@ uint16 adcReadSampled(uint8 channel, uint8 resolution, uint8 reference, uint8 sa
     }
     return samplesSum /samplesCount;
 }
+
+
+// 100000 * log10(1 + i / 32), generated with
+// python -c "import math; print([round(100000 * math.log10(1 + i / 32)) for i in range(33)])"
+static CONST uint16 logLuxMantissa[] = {0,     1336,  2633,  3892,  5115,  6305,  7463,  8591,  9691,  10763, 11810,
+                                        12832, 13830, 14806, 15761, 16695, 17609, 18505, 19382, 20242, 21085, 21913,
+                                        22724, 23521, 24304, 25072, 25828, 26570, 27300, 28018, 28724, 29419, 30103};
+
+uint16 luxToZclIlluminance(uint32 lux) {
+    uint8 exponent = 31;
+    uint8 index;
+    uint16 frac;
+    uint32 value;
+
+    if (lux == 0) {
+        return 0;
+    }
+    // lux = 2^exponent * (1 + f), f is the bits below the leading one
+    while (!(lux & 0x80000000)) {
+        lux <<= 1;
+        exponent--;
+    }
+    index = (uint8)(lux >> 26) & 0x1F;
+    frac = (uint16)(lux >> 10);
+
+    // in 100000 * log10 units, 100000 * log10(2) = 30103
+    value = (uint32)exponent * 30103 + logLuxMantissa[index] +
+            (((uint32)(logLuxMantissa[index + 1] - logLuxMantissa[index]) * frac) >> 16);
+    value = (value + 5) / 10 + 1;
+    return (value > 0xFFFE) ? 0xFFFE : (uint16)value;
+}
+
+uint16 crc16Ccitt(const uint8 *data, uint16 len) {
+    uint16 crc = 0xFFFF;
+    while (len--) {
+        crc ^= (uint16)(*data++) << 8;
+        for (uint8 i = 0; i < 8; i++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+        }
+    }
+    return crc;
+}
+
+uint16 crc16Modbus(const uint8 *data, uint16 len) {
+    uint16 crc = 0xFFFF;
+    while (len--) {
+        crc ^= *data++;
+        for (uint8 i = 0; i < 8; i++) {
+            crc = (crc & 0x0001) ? (crc >> 1) ^ 0xA001 : (crc >> 1);
+        }
+    }
+    return crc;
+}
+
+uint32 ratioToFloat(uint32 numerator, uint32 denominator) {
+    int16 exponent = 0;
+    uint32 mantissa = 0;
+
+    if (numerator == 0 || denominator == 0) {
+        return 0;
+    }
+    // denominator <= numerator < 2 * denominator, the ratio is 1.x * 2^exponent
+    while (numerator >= (denominator << 1)) {
+        denominator <<= 1;
+        exponent++;
+    }
+    while (numerator < denominator) {
+        numerator <<= 1;
+        exponent--;
+    }
+    // 24 bits with the leading one, long division
+    for (uint8 i = 0; i < 24; i++) {
+        mantissa <<= 1;
+        if (numerator >= denominator) {
+            mantissa |= 1;
+            numerator -= denominator;
+        }
+        numerator <<= 1;
+    }
+    // round half up
+    if (numerator >= denominator) {
+        mantissa++;
+        if (mantissa >> 24) {
+            mantissa >>= 1;
+            exponent++;
+        }
+    }
+    return ((uint32)(exponent + 127) << 23) | (mantissa & 0x007FFFFF);
+}
@@ -1,9 +1,32 @@
 #ifndef UTILS_H
 #define UTILS_H
-extern double mapRange(double a1, double a2, double b1, double b2, double s);
+// Linear map of s from a1..a2 to b1..b2 (b1 < b2), rounded and clamped
+extern int32 mapRange(int32 a1, int32 a2, int32 b1, int32 b2, int32 s);
+
+// Piecewise-linear curve, X ascending, clamped outside
+typedef struct {
+    uint16 X;
+    uint16 Y;
+} curvePoint_t;
+
+extern uint16 curveInterpolate(CONST curvePoint_t *curve, uint8 length, uint16 x);
 
 extern uint16 adcReadSampled(uint8 channel, uint8 resolution, uint8 reference, uint8 samplesCount);
 
+// ZCL illuminance MeasuredValue 10000 * log10(lux) + 1, 0 for 0 lux.
+// Integer only, within 1.1 of the exact value
+extern uint16 luxToZclIlluminance(uint32 lux);
+
+// CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF)
+extern uint16 crc16Ccitt(const uint8 *data, uint16 len);
+
+// CRC-16/MODBUS (poly 0xA001 reflected, init 0xFFFF), sent low byte first
+extern uint16 crc16Modbus(const uint8 *data, uint16 len);
+
+// IEEE 754 single precision bits of numerator / denominator for ZCL_SINGLE
+// attributes, without the float library. Both below 2^30
+extern uint32 ratioToFloat(uint32 numerator, uint32 denominator);
+
 
 #undef P
 #undef INP